@@ -0,0 +1,460 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "arena.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Bits used in the ucFlags member of an arena. */
+#define arenaFLAG_CAN_GROW				( ( uint8_t ) 0x01 )
+#define arenaFLAG_ALLOCATED_FROM_HEAP	( ( uint8_t ) 0x02 )
+
+/*
+ * Header at the start of each chunk.  The header of the first chunk is held in
+ * the arena structure, and the first chunk follows the structure.  Chunks that
+ * are added when the arena grows are linked on in the order they are used.
+ */
+typedef struct ARENA_CHUNK
+{
+	struct ARENA_CHUNK *pxNextChunk;	/*< The chunk used when this one is full, or NULL. */
+	uint8_t *pucStart;					/*< The first byte that can be allocated from the chunk. */
+	uint8_t *pucEnd;					/*< One past the last byte that can be allocated from the chunk. */
+} ArenaChunk_t;
+
+/*
+ * Definition of an arena.
+ */
+typedef struct ArenaDefinition
+{
+	uint8_t *pucNextFree;				/*< The next unallocated byte in the current chunk. */
+	uint8_t *pucChunkEnd;				/*< A copy of pxCurrentChunk->pucEnd, so the fast path of an allocation only accesses the arena structure. */
+	ArenaChunk_t *pxCurrentChunk;		/*< The chunk being allocated from. */
+	ArenaChunk_t xFirstChunk;			/*< The header of the first chunk, which is never freed until the arena is deleted. */
+	size_t xChunkSize;					/*< The usable size of chunks added when the arena grows. */
+	size_t xBytesInPreviousChunks;		/*< Bytes handed out from the chunks before the current chunk since the arena was reset. */
+	size_t xMaximumEverBytesInUse;		/*< Updated when the arena is reset, and when the stats are read. */
+	size_t xCapacity;					/*< The total usable size of all the chunks. */
+	UBaseType_t uxChunkCount;			/*< The number of chunks, including the first. */
+	uint32_t ulAllocationFailures;		/*< The number of allocations that returned NULL. */
+	uint8_t ucFlags;					/*< arenaFLAG_ bits. */
+} Arena_t;
+
+/* The sizes of the arena structure and chunk header rounded up so the memory
+that follows them is aligned. */
+#define arenaSTRUCT_SIZE		( ( sizeof( Arena_t ) + ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+#define arenaCHUNK_HEADER_SIZE	( ( sizeof( ArenaChunk_t ) + ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* The number of bytes that must be skipped to align pucAddress to xAlignment,
+which is a power of two. */
+#define arenaPADDING( pucAddress, xAlignment )	( ( ( xAlignment ) - ( ( size_t ) ( portPOINTER_SIZE_TYPE ) ( pucAddress ) & ( ( xAlignment ) - ( size_t ) 1 ) ) ) & ( ( xAlignment ) - ( size_t ) 1 ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialise the arena structure pxArena, the first chunk of which is
+ * xChunkSize bytes long and follows the structure.
+ */
+static void prvInitialiseArena( Arena_t * const pxArena, const size_t xChunkSize, const uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when an allocation does not fit in the current chunk.  Moves on to a
+ * later chunk that is large enough, adding a chunk from the FreeRTOS heap if
+ * there is none, then makes the allocation from it.  Returns
+ * NULL if the arena cannot grow or the FreeRTOS heap is exhausted.
+ */
+static void *prvAllocateFromNextChunk( Arena_t * const pxArena, const size_t xSize, const size_t xAlignment ) PRIVILEGED_FUNCTION;
+
+/*
+ * Update the high water mark from the number of bytes currently in use.
+ */
+static void prvUpdateMaximumEverBytesInUse( Arena_t * const pxArena ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+ArenaHandle_t xArenaCreate( size_t xChunkSize, BaseType_t xCanGrow )
+{
+Arena_t *pxArena;
+
+	configASSERT( xChunkSize > ( size_t ) 0 );
+
+	pxArena = ( Arena_t * ) pvPortMalloc( arenaSTRUCT_SIZE + xChunkSize );
+
+	if( pxArena != NULL )
+	{
+		prvInitialiseArena( pxArena, xChunkSize, ( xCanGrow != pdFALSE ) ? ( arenaFLAG_CAN_GROW | arenaFLAG_ALLOCATED_FROM_HEAP ) : arenaFLAG_ALLOCATED_FROM_HEAP );
+		traceARENA_CREATE( pxArena );
+	}
+	else
+	{
+		traceARENA_CREATE_FAILED();
+	}
+
+	return ( ArenaHandle_t ) pxArena;
+}
+/*-----------------------------------------------------------*/
+
+ArenaHandle_t xArenaCreateFromBuffer( void *pvBuffer, size_t xBufferSize, BaseType_t xCanGrow )
+{
+Arena_t *pxArena = NULL;
+size_t xPadding;
+
+	configASSERT( pvBuffer );
+
+	/* The arena structure goes at the first aligned address in the buffer. */
+	xPadding = arenaPADDING( pvBuffer, ( size_t ) portBYTE_ALIGNMENT );
+
+	if( xBufferSize >= ( xPadding + arenaSTRUCT_SIZE ) )
+	{
+		pxArena = ( Arena_t * ) ( ( ( uint8_t * ) pvBuffer ) + xPadding ); /*lint !e826 The buffer is large enough and has been aligned. */
+		prvInitialiseArena( pxArena, xBufferSize - xPadding - arenaSTRUCT_SIZE, ( xCanGrow != pdFALSE ) ? arenaFLAG_CAN_GROW : ( uint8_t ) 0 );
+		traceARENA_CREATE( pxArena );
+	}
+	else
+	{
+		traceARENA_CREATE_FAILED();
+	}
+
+	return ( ArenaHandle_t ) pxArena;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseArena( Arena_t * const pxArena, const size_t xChunkSize, const uint8_t ucFlags )
+{
+	pxArena->xFirstChunk.pxNextChunk = NULL;
+	pxArena->xFirstChunk.pucStart = ( ( uint8_t * ) pxArena ) + arenaSTRUCT_SIZE;
+	pxArena->xFirstChunk.pucEnd = pxArena->xFirstChunk.pucStart + xChunkSize;
+	pxArena->pxCurrentChunk = &( pxArena->xFirstChunk );
+	pxArena->pucNextFree = pxArena->xFirstChunk.pucStart;
+	pxArena->pucChunkEnd = pxArena->xFirstChunk.pucEnd;
+	pxArena->xChunkSize = xChunkSize;
+	pxArena->xBytesInPreviousChunks = ( size_t ) 0;
+	pxArena->xMaximumEverBytesInUse = ( size_t ) 0;
+	pxArena->xCapacity = xChunkSize;
+	pxArena->uxChunkCount = ( UBaseType_t ) 1;
+	pxArena->ulAllocationFailures = 0UL;
+	pxArena->ucFlags = ucFlags;
+}
+/*-----------------------------------------------------------*/
+
+void *pvArenaAlloc( ArenaHandle_t xArena, size_t xSize )
+{
+	return pvArenaAllocAligned( xArena, xSize, ( size_t ) portBYTE_ALIGNMENT );
+}
+/*-----------------------------------------------------------*/
+
+void *pvArenaAllocAligned( ArenaHandle_t xArena, size_t xSize, size_t xAlignment )
+{
+Arena_t * const pxArena = ( Arena_t * ) xArena;
+size_t xPadding, xAvailable;
+void *pvReturn;
+
+	configASSERT( pxArena );
+	configASSERT( xAlignment != ( size_t ) 0 );
+	configASSERT( ( xAlignment & ( xAlignment - ( size_t ) 1 ) ) == ( size_t ) 0 );
+
+	xPadding = arenaPADDING( pxArena->pucNextFree, xAlignment );
+	xAvailable = ( size_t ) ( pxArena->pucChunkEnd - pxArena->pucNextFree );
+
+	/* Written so neither the padding nor the size can cause an overflow. */
+	if( ( xPadding <= xAvailable ) && ( xSize <= ( xAvailable - xPadding ) ) )
+	{
+		pvReturn = ( void * ) ( pxArena->pucNextFree + xPadding );
+		pxArena->pucNextFree += xPadding + xSize;
+	}
+	else
+	{
+		pvReturn = prvAllocateFromNextChunk( pxArena, xSize, xAlignment );
+	}
+
+	traceARENA_ALLOC( pxArena, pvReturn );
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvAllocateFromNextChunk( Arena_t * const pxArena, const size_t xSize, const size_t xAlignment )
+{
+ArenaChunk_t *pxChunk, *pxPreviousChunk;
+size_t xNeeded, xChunkSize;
+void *pvReturn = NULL;
+
+	/* Chunks start on a portBYTE_ALIGNMENT boundary, so larger alignments
+	might need padding of up to xAlignment - portBYTE_ALIGNMENT bytes. */
+	if( xAlignment > ( size_t ) portBYTE_ALIGNMENT )
+	{
+		xNeeded = xSize + ( xAlignment - ( size_t ) portBYTE_ALIGNMENT );
+	}
+	else
+	{
+		xNeeded = xSize;
+	}
+
+	/* Check for overflow. */
+	if( xNeeded >= xSize )
+	{
+		/* Look for a chunk that was kept when the arena was last reset and is
+		large enough.  Chunks that are too small are skipped, but stay linked
+		after the chunk that is found so they can be used by later, smaller,
+		allocations. */
+		pxPreviousChunk = pxArena->pxCurrentChunk;
+		pxChunk = pxPreviousChunk->pxNextChunk;
+
+		while( ( pxChunk != NULL ) && ( ( size_t ) ( pxChunk->pucEnd - pxChunk->pucStart ) < xNeeded ) )
+		{
+			pxPreviousChunk = pxChunk;
+			pxChunk = pxChunk->pxNextChunk;
+		}
+
+		if( pxChunk != NULL )
+		{
+			if( pxPreviousChunk != pxArena->pxCurrentChunk )
+			{
+				/* Move the chunk so it follows the current chunk. */
+				pxPreviousChunk->pxNextChunk = pxChunk->pxNextChunk;
+				pxChunk->pxNextChunk = pxArena->pxCurrentChunk->pxNextChunk;
+				pxArena->pxCurrentChunk->pxNextChunk = pxChunk;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* No chunk is large enough, so add a new one after the current
+			chunk. */
+			if( ( pxArena->ucFlags & arenaFLAG_CAN_GROW ) != 0 )
+			{
+				xChunkSize = ( xNeeded > pxArena->xChunkSize ) ? xNeeded : pxArena->xChunkSize;
+
+				if( ( xChunkSize + arenaCHUNK_HEADER_SIZE ) > xChunkSize )
+				{
+					pxChunk = ( ArenaChunk_t * ) pvPortMalloc( arenaCHUNK_HEADER_SIZE + xChunkSize );
+				}
+				else
+				{
+					pxChunk = NULL;
+				}
+
+				if( pxChunk != NULL )
+				{
+					pxChunk->pucStart = ( ( uint8_t * ) pxChunk ) + arenaCHUNK_HEADER_SIZE;
+					pxChunk->pucEnd = pxChunk->pucStart + xChunkSize;
+					pxChunk->pxNextChunk = pxArena->pxCurrentChunk->pxNextChunk;
+					pxArena->pxCurrentChunk->pxNextChunk = pxChunk;
+					pxArena->xCapacity += xChunkSize;
+					( pxArena->uxChunkCount )++;
+					traceARENA_GROW( pxArena, xChunkSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( pxChunk != NULL )
+		{
+			/* The space left at the end of the current chunk is abandoned until
+			the arena is reset. */
+			pxArena->xBytesInPreviousChunks += ( size_t ) ( pxArena->pucNextFree - pxArena->pxCurrentChunk->pucStart );
+			pxArena->pxCurrentChunk = pxChunk;
+			pxArena->pucChunkEnd = pxChunk->pucEnd;
+
+			pvReturn = ( void * ) ( pxChunk->pucStart + arenaPADDING( pxChunk->pucStart, xAlignment ) );
+			pxArena->pucNextFree = ( ( uint8_t * ) pvReturn ) + xSize;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pvReturn == NULL )
+	{
+		( pxArena->ulAllocationFailures )++;
+		traceARENA_ALLOC_FAILED( pxArena );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUpdateMaximumEverBytesInUse( Arena_t * const pxArena )
+{
+size_t xBytesInUse;
+
+	xBytesInUse = pxArena->xBytesInPreviousChunks + ( size_t ) ( pxArena->pucNextFree - pxArena->pxCurrentChunk->pucStart );
+
+	/* The number of bytes in use only goes down when the arena is reset, so
+	the high water mark only needs updating here rather than on every
+	allocation. */
+	if( xBytesInUse > pxArena->xMaximumEverBytesInUse )
+	{
+		pxArena->xMaximumEverBytesInUse = xBytesInUse;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vArenaReset( ArenaHandle_t xArena )
+{
+Arena_t * const pxArena = ( Arena_t * ) xArena;
+
+	configASSERT( pxArena );
+
+	prvUpdateMaximumEverBytesInUse( pxArena );
+
+	/* The chunks stay linked in the order they were used, so are used again
+	in the same order. */
+	pxArena->pxCurrentChunk = &( pxArena->xFirstChunk );
+	pxArena->pucNextFree = pxArena->xFirstChunk.pucStart;
+	pxArena->pucChunkEnd = pxArena->xFirstChunk.pucEnd;
+	pxArena->xBytesInPreviousChunks = ( size_t ) 0;
+
+	traceARENA_RESET( pxArena );
+}
+/*-----------------------------------------------------------*/
+
+void vArenaGetStats( ArenaHandle_t xArena, ArenaStats_t *pxStats )
+{
+Arena_t * const pxArena = ( Arena_t * ) xArena;
+
+	configASSERT( pxArena );
+	configASSERT( pxStats );
+
+	prvUpdateMaximumEverBytesInUse( pxArena );
+
+	pxStats->xBytesInUse = pxArena->xBytesInPreviousChunks + ( size_t ) ( pxArena->pucNextFree - pxArena->pxCurrentChunk->pucStart );
+	pxStats->xMaximumEverBytesInUse = pxArena->xMaximumEverBytesInUse;
+	pxStats->xCapacity = pxArena->xCapacity;
+	pxStats->uxChunkCount = pxArena->uxChunkCount;
+	pxStats->ulAllocationFailures = pxArena->ulAllocationFailures;
+}
+/*-----------------------------------------------------------*/
+
+void vArenaDelete( ArenaHandle_t xArena )
+{
+Arena_t * const pxArena = ( Arena_t * ) xArena;
+ArenaChunk_t *pxChunk, *pxNextChunk;
+
+	configASSERT( pxArena );
+
+	traceARENA_DELETE( pxArena );
+
+	pxChunk = pxArena->xFirstChunk.pxNextChunk;
+
+	while( pxChunk != NULL )
+	{
+		pxNextChunk = pxChunk->pxNextChunk;
+		vPortFree( pxChunk );
+		pxChunk = pxNextChunk;
+	}
+
+	if( ( pxArena->ucFlags & arenaFLAG_ALLOCATED_FROM_HEAP ) != 0 )
+	{
+		vPortFree( pxArena );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+
+
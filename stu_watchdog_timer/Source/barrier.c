@@ -0,0 +1,283 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "barrier.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* The following bits are written into a blocked task's event list item value
+to tell the task why it was unblocked.  It is important they don't clash with
+the taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
+#if configUSE_16_BIT_TICKS == 1
+	#define barrierUNBLOCKED_BY_RELEASE		0x0100U
+	#define barrierUNBLOCKED_BY_DELETE		0x0200U
+#else
+	#define barrierUNBLOCKED_BY_RELEASE		0x01000000UL
+	#define barrierUNBLOCKED_BY_DELETE		0x02000000UL
+#endif
+
+typedef struct BarrierDefinition
+{
+	UBaseType_t uxParticipants;		/*< The number of tasks that must arrive to complete a round. */
+	UBaseType_t uxArrived;			/*< The number of tasks that have arrived in the current round. */
+	UBaseType_t uxGeneration;		/*< Incremented each time a round completes. */
+	List_t xTasksWaitingForRelease;	/*< List of tasks that have arrived and are blocked waiting for the round to complete.  Not ordered. */
+} Barrier_t;
+
+/*-----------------------------------------------------------*/
+
+BarrierHandle_t xBarrierCreate( const UBaseType_t uxParticipants )
+{
+Barrier_t *pxBarrier;
+
+	configASSERT( uxParticipants > ( UBaseType_t ) 0 );
+
+	pxBarrier = ( Barrier_t * ) pvPortMalloc( sizeof( Barrier_t ) );
+
+	if( pxBarrier != NULL )
+	{
+		pxBarrier->uxParticipants = uxParticipants;
+		pxBarrier->uxArrived = ( UBaseType_t ) 0;
+		pxBarrier->uxGeneration = ( UBaseType_t ) 0;
+		vListInitialise( &( pxBarrier->xTasksWaitingForRelease ) );
+		traceBARRIER_CREATE( pxBarrier );
+	}
+	else
+	{
+		traceBARRIER_CREATE_FAILED();
+	}
+
+	return ( BarrierHandle_t ) pxBarrier;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBarrierWait( BarrierHandle_t xBarrier, TickType_t xTicksToWait )
+{
+Barrier_t * const pxBarrier = ( Barrier_t * ) xBarrier;
+const List_t * const pxWaitingList = &( pxBarrier->xTasksWaitingForRelease );
+BaseType_t xReturn, xAlreadyYielded;
+UBaseType_t uxGeneration;
+TickType_t uxUnblockReason;
+
+	configASSERT( pxBarrier );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* Barriers are not accessed from interrupts, so, as with event groups, the
+	scheduler is suspended rather than interrupts disabled while the barrier is
+	updated. */
+	vTaskSuspendAll();
+	{
+		traceBARRIER_WAIT( pxBarrier );
+
+		uxGeneration = pxBarrier->uxGeneration;
+		( pxBarrier->uxArrived )++;
+
+		if( pxBarrier->uxArrived >= pxBarrier->uxParticipants )
+		{
+			/* This is the last task to arrive.  Start the next round, then
+			release every task that arrived in this round in a single pass. */
+			traceBARRIER_RELEASE( pxBarrier );
+			pxBarrier->uxArrived = ( UBaseType_t ) 0;
+			( pxBarrier->uxGeneration )++;
+
+			while( listCURRENT_LIST_LENGTH( pxWaitingList ) > ( UBaseType_t ) 0 )
+			{
+				( void ) xTaskRemoveFromUnorderedEventList( listGET_HEAD_ENTRY( pxWaitingList ), barrierUNBLOCKED_BY_RELEASE );
+			}
+
+			xReturn = pdPASS;
+			xTicksToWait = ( TickType_t ) 0;
+		}
+		else if( xTicksToWait == ( TickType_t ) 0 )
+		{
+			/* The other participants have not arrived and no block time was
+			specified, so withdraw from the round. */
+			( pxBarrier->uxArrived )--;
+			traceBARRIER_WAIT_FAILED( pxBarrier );
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			traceBLOCKING_ON_BARRIER_WAIT( pxBarrier );
+			vTaskPlaceOnUnorderedEventList( &( pxBarrier->xTasksWaitingForRelease ), ( TickType_t ) 0, xTicksToWait );
+
+			/* Set when the task unblocks. */
+			xReturn = pdFAIL;
+		}
+	}
+	xAlreadyYielded = xTaskResumeAll();
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The task was either released by the last task to arrive, released
+		because the barrier was deleted, or its block time expired.  The
+		reason is held in the task's event list item. */
+		uxUnblockReason = uxTaskResetEventItemValue();
+
+		if( ( uxUnblockReason & barrierUNBLOCKED_BY_RELEASE ) != ( TickType_t ) 0 )
+		{
+			xReturn = pdPASS;
+		}
+		else if( ( uxUnblockReason & barrierUNBLOCKED_BY_DELETE ) != ( TickType_t ) 0 )
+		{
+			/* The barrier no longer exists so must not be accessed. */
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			vTaskSuspendAll();
+			{
+				if( pxBarrier->uxGeneration == uxGeneration )
+				{
+					/* The block time expired and the round has still not
+					completed, so withdraw from it. */
+					configASSERT( pxBarrier->uxArrived > ( UBaseType_t ) 0 );
+					( pxBarrier->uxArrived )--;
+					traceBARRIER_WAIT_FAILED( pxBarrier );
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					/* The round completed after the block time expired but
+					before this task could withdraw from it.  This task's
+					arrival was counted in the release, so treat it as
+					released. */
+					xReturn = pdPASS;
+				}
+			}
+			( void ) xTaskResumeAll();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBarrierGetGeneration( BarrierHandle_t xBarrier )
+{
+	configASSERT( xBarrier );
+
+	return ( ( Barrier_t * ) xBarrier )->uxGeneration;
+}
+/*-----------------------------------------------------------*/
+
+void vBarrierDelete( BarrierHandle_t xBarrier )
+{
+Barrier_t * const pxBarrier = ( Barrier_t * ) xBarrier;
+const List_t * const pxWaitingList = &( pxBarrier->xTasksWaitingForRelease );
+
+	configASSERT( pxBarrier );
+
+	vTaskSuspendAll();
+	{
+		traceBARRIER_DELETE( pxBarrier );
+
+		while( listCURRENT_LIST_LENGTH( pxWaitingList ) > ( UBaseType_t ) 0 )
+		{
+			( void ) xTaskRemoveFromUnorderedEventList( listGET_HEAD_ENTRY( pxWaitingList ), barrierUNBLOCKED_BY_DELETE );
+		}
+
+		vPortFree( pxBarrier );
+	}
+	( void ) xTaskResumeAll();
+}
+
+
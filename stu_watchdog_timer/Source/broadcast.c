@@ -0,0 +1,498 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "broadcast.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/*
+ * Definition of a broadcast channel.  The channel itself does not know who its
+ * subscribers are - each subscriber holds its own read cursor, so an item is
+ * copied once no matter how many subscribers there are.  Publishing does have
+ * to unblock every subscriber that is blocked on the channel, but does so one
+ * task per critical section so the time interrupts are masked for does not
+ * grow with the number of subscribers.
+ *
+ * uxPublished is a free running count of the items that have ever been
+ * published.  A subscriber compares the count with its own count of the items
+ * it has read to know how many items are waiting for it, and whether any items
+ * it had not read have been overwritten.  The counts are unsigned so wrap
+ * around correctly.
+ */
+typedef struct BroadcastDefinition
+{
+	int8_t *pcHead;					/*< Points to the beginning of the ring buffer. */
+	UBaseType_t uxLength;			/*< The number of items the ring buffer can hold. */
+	UBaseType_t uxItemSize;			/*< The size of each item. */
+	UBaseType_t uxWriteIndex;		/*< The index of the slot the next item will be written to.  When the ring buffer is full this is also the index of the oldest item. */
+	volatile UBaseType_t uxPublished;	/*< The number of items ever published to the channel. */
+	List_t xTasksWaitingToReceive;	/*< List of subscriber tasks that are blocked waiting for an item to be published.  Stored in priority order. */
+} Broadcast_t;
+
+typedef struct BroadcastSubscriberDefinition
+{
+	Broadcast_t *pxBroadcast;		/*< The channel being read. */
+	UBaseType_t uxReadIndex;		/*< The index of the slot the next item will be read from. */
+	UBaseType_t uxReceived;			/*< The number of items ever published to the channel that this subscriber has either read or lost. */
+} BroadcastSubscriber_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copies an item into the ring buffer.  Must be called from a critical
+ * section.  Returns the number of subscribers that were blocked waiting for
+ * the item, which the caller must then unblock.
+ */
+static UBaseType_t prvPublish( Broadcast_t * const pxBroadcast, const void * const pvItemToPublish ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the highest priority subscriber that is blocked on the channel, if
+ * there is one.  Must be called from a critical section.  Returns pdTRUE if a
+ * task that has a priority above the calling task was unblocked.
+ */
+static BaseType_t prvUnblockSubscriber( Broadcast_t * const pxBroadcast ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BroadcastHandle_t xBroadcastCreate( const UBaseType_t uxLength, const UBaseType_t uxItemSize )
+{
+Broadcast_t *pxBroadcast;
+size_t xBufferSizeInBytes;
+
+	configASSERT( uxLength > ( UBaseType_t ) 0 );
+	configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+	xBufferSizeInBytes = ( size_t ) ( uxLength * uxItemSize );
+
+	/* Allocate the channel and its ring buffer in one block. */
+	pxBroadcast = ( Broadcast_t * ) pvPortMalloc( sizeof( Broadcast_t ) + xBufferSizeInBytes );
+
+	if( pxBroadcast != NULL )
+	{
+		/* Jump past the channel structure to find the location of the ring
+		buffer. */
+		pxBroadcast->pcHead = ( ( int8_t * ) pxBroadcast ) + sizeof( Broadcast_t );
+		pxBroadcast->uxLength = uxLength;
+		pxBroadcast->uxItemSize = uxItemSize;
+		pxBroadcast->uxWriteIndex = ( UBaseType_t ) 0U;
+		pxBroadcast->uxPublished = ( UBaseType_t ) 0U;
+		vListInitialise( &( pxBroadcast->xTasksWaitingToReceive ) );
+		traceBROADCAST_CREATE( pxBroadcast );
+	}
+	else
+	{
+		traceBROADCAST_CREATE_FAILED();
+	}
+
+	return ( BroadcastHandle_t ) pxBroadcast;
+}
+/*-----------------------------------------------------------*/
+
+BroadcastSubscriberHandle_t xBroadcastSubscribe( BroadcastHandle_t xBroadcast )
+{
+BroadcastSubscriber_t *pxSubscriber;
+Broadcast_t * const pxBroadcast = ( Broadcast_t * ) xBroadcast;
+
+	configASSERT( pxBroadcast );
+
+	pxSubscriber = ( BroadcastSubscriber_t * ) pvPortMalloc( sizeof( BroadcastSubscriber_t ) );
+
+	if( pxSubscriber != NULL )
+	{
+		pxSubscriber->pxBroadcast = pxBroadcast;
+
+		/* Start reading from the next item to be published. */
+		taskENTER_CRITICAL();
+		{
+			pxSubscriber->uxReadIndex = pxBroadcast->uxWriteIndex;
+			pxSubscriber->uxReceived = pxBroadcast->uxPublished;
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( BroadcastSubscriberHandle_t ) pxSubscriber;
+}
+/*-----------------------------------------------------------*/
+
+void vBroadcastUnsubscribe( BroadcastSubscriberHandle_t xSubscriber )
+{
+	configASSERT( xSubscriber );
+	vPortFree( xSubscriber );
+}
+/*-----------------------------------------------------------*/
+
+void vBroadcastPublish( BroadcastHandle_t xBroadcast, const void * const pvItemToPublish )
+{
+Broadcast_t * const pxBroadcast = ( Broadcast_t * ) xBroadcast;
+UBaseType_t uxWaiting;
+
+	configASSERT( pxBroadcast );
+	configASSERT( pvItemToPublish );
+
+	/* The scheduler is suspended so the subscribers that are unblocked cannot
+	run, and block on the channel again, before all the subscribers that were
+	waiting for this item have been unblocked. */
+	vTaskSuspendAll();
+	{
+		taskENTER_CRITICAL();
+		{
+			traceBROADCAST_PUBLISH( pxBroadcast );
+			uxWaiting = prvPublish( pxBroadcast, pvItemToPublish );
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts are unmasked between each subscriber that is unblocked. */
+		while( uxWaiting > ( UBaseType_t ) 0 )
+		{
+			taskENTER_CRITICAL();
+			{
+				( void ) prvUnblockSubscriber( pxBroadcast );
+			}
+			taskEXIT_CRITICAL();
+
+			uxWaiting--;
+		}
+	}
+	/* Resuming the scheduler yields if a subscriber that has a priority above
+	this task was unblocked. */
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vBroadcastPublishFromISR( BroadcastHandle_t xBroadcast, const void * const pvItemToPublish, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+Broadcast_t * const pxBroadcast = ( Broadcast_t * ) xBroadcast;
+UBaseType_t uxSavedInterruptStatus, uxWaiting;
+BaseType_t xUnblockedHigherPriorityTask;
+
+	configASSERT( pxBroadcast );
+	configASSERT( pvItemToPublish );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+	system call interrupt priority. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		traceBROADCAST_PUBLISH_FROM_ISR( pxBroadcast );
+		uxWaiting = prvPublish( pxBroadcast, pvItemToPublish );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	/* The interrupt mask is cleared between each subscriber that is unblocked,
+	so interrupts above this one are only held off for the time taken to
+	unblock one task.  The time spent in this function still grows with the
+	number of subscribers that were blocked.  Tasks cannot run until this
+	interrupt exits, so no subscriber can block on the channel again in the
+	meantime. */
+	while( uxWaiting > ( UBaseType_t ) 0 )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xUnblockedHigherPriorityTask = prvUnblockSubscriber( pxBroadcast );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( ( xUnblockedHigherPriorityTask != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+		{
+			*pxHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxWaiting--;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBroadcastReceive( BroadcastSubscriberHandle_t xSubscriber, void * const pvBuffer, UBaseType_t * const puxItemsLost, TickType_t xTicksToWait )
+{
+BroadcastSubscriber_t * const pxSubscriber = ( BroadcastSubscriber_t * ) xSubscriber;
+Broadcast_t *pxBroadcast;
+UBaseType_t uxItemsWaiting, uxItemsLost = ( UBaseType_t ) 0;
+BaseType_t xEntryTimeSet = pdFALSE, xReturn = pdFAIL;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxSubscriber );
+	configASSERT( pvBuffer );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	pxBroadcast = pxSubscriber->pxBroadcast;
+
+	/* The ring buffer can be written from an interrupt, so it is only accessed
+	from within a critical section.  That also allows the task to be placed on
+	the event list and the yield to be requested atomically with the test for
+	data - the yield is held pending until the critical section is exited. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxItemsWaiting = pxBroadcast->uxPublished - pxSubscriber->uxReceived;
+
+			if( uxItemsWaiting > ( UBaseType_t ) 0 )
+			{
+				if( uxItemsWaiting > pxBroadcast->uxLength )
+				{
+					/* Items that had not been read have been overwritten.  Skip
+					to the oldest item that is still available, which is the
+					item that will be overwritten next. */
+					uxItemsLost = uxItemsWaiting - pxBroadcast->uxLength;
+					pxSubscriber->uxReadIndex = pxBroadcast->uxWriteIndex;
+					pxSubscriber->uxReceived += uxItemsLost;
+					traceBROADCAST_OVERRUN( pxBroadcast, pxSubscriber, uxItemsLost );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				( void ) memcpy( pvBuffer, ( void * ) ( pxBroadcast->pcHead + ( pxSubscriber->uxReadIndex * pxBroadcast->uxItemSize ) ), ( size_t ) pxBroadcast->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports.  Assert checks null pointer only used when length is 0. */
+
+				( pxSubscriber->uxReadIndex )++;
+				if( pxSubscriber->uxReadIndex >= pxBroadcast->uxLength )
+				{
+					pxSubscriber->uxReadIndex = ( UBaseType_t ) 0U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				( pxSubscriber->uxReceived )++;
+
+				traceBROADCAST_RECEIVE( pxBroadcast, pxSubscriber );
+				xReturn = pdPASS;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* Nothing to read and no block time was specified (or the
+				block time has expired). */
+				traceBROADCAST_RECEIVE_FAILED( pxBroadcast, pxSubscriber );
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					traceBLOCKING_ON_BROADCAST_RECEIVE( pxBroadcast, pxSubscriber );
+					vTaskPlaceOnEventList( &( pxBroadcast->xTasksWaitingToReceive ), xTicksToWait );
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					/* Timed out.  Go around the loop once more so the ring
+					buffer is checked a final time with xTicksToWait now
+					zero. */
+					xTicksToWait = ( TickType_t ) 0;
+				}
+
+				/* Loop back to test for data again. */
+				taskEXIT_CRITICAL();
+				continue;
+			}
+		}
+		taskEXIT_CRITICAL();
+		break;
+	}
+
+	if( puxItemsLost != NULL )
+	{
+		*puxItemsLost = uxItemsLost;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBroadcastItemsWaiting( BroadcastSubscriberHandle_t xSubscriber )
+{
+BroadcastSubscriber_t * const pxSubscriber = ( BroadcastSubscriber_t * ) xSubscriber;
+UBaseType_t uxReturn;
+
+	configASSERT( pxSubscriber );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = pxSubscriber->pxBroadcast->uxPublished - pxSubscriber->uxReceived;
+	}
+	taskEXIT_CRITICAL();
+
+	if( uxReturn > pxSubscriber->pxBroadcast->uxLength )
+	{
+		uxReturn = pxSubscriber->pxBroadcast->uxLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vBroadcastDelete( BroadcastHandle_t xBroadcast )
+{
+Broadcast_t * const pxBroadcast = ( Broadcast_t * ) xBroadcast;
+
+	configASSERT( pxBroadcast );
+
+	/* Subscribers must not be blocked on a channel that is being deleted. */
+	configASSERT( listLIST_IS_EMPTY( &( pxBroadcast->xTasksWaitingToReceive ) ) != pdFALSE );
+
+	traceBROADCAST_DELETE( pxBroadcast );
+	vPortFree( pxBroadcast );
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvPublish( Broadcast_t * const pxBroadcast, const void * const pvItemToPublish )
+{
+
+	/* This function must be called from a critical section. */
+
+	( void ) memcpy( ( void * ) ( pxBroadcast->pcHead + ( pxBroadcast->uxWriteIndex * pxBroadcast->uxItemSize ) ), pvItemToPublish, ( size_t ) pxBroadcast->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+
+	( pxBroadcast->uxWriteIndex )++;
+	if( pxBroadcast->uxWriteIndex >= pxBroadcast->uxLength )
+	{
+		pxBroadcast->uxWriteIndex = ( UBaseType_t ) 0U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( pxBroadcast->uxPublished )++;
+
+	/* Every blocked subscriber has now got an item to read.  Subscribers that
+	are not blocked are not visited at all - they will find the item the next
+	time they read the channel. */
+	return listCURRENT_LIST_LENGTH( &( pxBroadcast->xTasksWaitingToReceive ) );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockSubscriber( Broadcast_t * const pxBroadcast )
+{
+BaseType_t xReturn = pdFALSE;
+
+	/* This function must be called from a critical section.  The subscriber
+	may already have been unblocked by an interrupt that published another
+	item. */
+	if( listLIST_IS_EMPTY( &( pxBroadcast->xTasksWaitingToReceive ) ) == pdFALSE )
+	{
+		xReturn = xTaskRemoveFromEventList( &( pxBroadcast->xTasksWaitingToReceive ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+
+
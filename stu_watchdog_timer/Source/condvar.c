@@ -0,0 +1,284 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "condvar.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+
+/* This entire source file will be skipped if the application is not configured
+to include mutex functionality.  This #if is closed at the very bottom of this
+file.  If you want to include condition variables then ensure configUSE_MUTEXES
+is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MUTEXES == 1 )
+
+typedef struct CondVarDefinition
+{
+	SemaphoreHandle_t xMutex;			/*< The mutex that protects the state the condition is evaluated over. */
+	List_t xTasksWaitingForSignal;		/*< List of tasks blocked waiting for the condition variable to be signalled.  Stored in priority order. */
+} CondVar_t;
+
+/*-----------------------------------------------------------*/
+
+CondVarHandle_t xCondVarCreate( SemaphoreHandle_t xMutex )
+{
+CondVar_t *pxCondVar;
+
+	configASSERT( xMutex );
+
+	pxCondVar = ( CondVar_t * ) pvPortMalloc( sizeof( CondVar_t ) );
+
+	if( pxCondVar != NULL )
+	{
+		pxCondVar->xMutex = xMutex;
+		vListInitialise( &( pxCondVar->xTasksWaitingForSignal ) );
+		traceCONDVAR_CREATE( pxCondVar );
+	}
+	else
+	{
+		traceCONDVAR_CREATE_FAILED();
+	}
+
+	return ( CondVarHandle_t ) pxCondVar;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xCondVarWait( CondVarHandle_t xCondVar, TickType_t xTicksToWait )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+BaseType_t xReturn;
+
+	configASSERT( pxCondVar );
+	#if ( INCLUDE_xSemaphoreGetMutexHolder == 1 )
+	{
+		/* The calling task must hold the mutex. */
+		configASSERT( xSemaphoreGetMutexHolder( pxCondVar->xMutex ) == xTaskGetCurrentTaskHandle() );
+	}
+	#endif
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED );
+	}
+	#endif
+
+	if( xTicksToWait == ( TickType_t ) 0 )
+	{
+		/* Nothing can signal the condition variable without the calling task
+		blocking, so there is no need to release the mutex. */
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		/* Releasing the mutex and placing the task on the event list are
+		performed in the same critical section, so the condition variable
+		cannot be signalled in between.  Giving a mutex never blocks, and any
+		yield requested by the give, or by placing this task on the event list,
+		is held pending until the critical section is exited. */
+		taskENTER_CRITICAL();
+		{
+			( void ) xSemaphoreGive( pxCondVar->xMutex );
+
+			traceBLOCKING_ON_CONDVAR_WAIT( pxCondVar );
+			vTaskPlaceOnEventList( &( pxCondVar->xTasksWaitingForSignal ), xTicksToWait );
+			portYIELD_WITHIN_API();
+		}
+		taskEXIT_CRITICAL();
+
+		/* The task was either signalled or its block time expired.  The signal
+		is recorded when it is sent, so a task that was signalled but then
+		waited for the mutex until after its block time expired still passes. */
+		if( xTaskResetSignalled() != pdFALSE )
+		{
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* Take the mutex again.  If the task was signalled while the mutex was
+		held then it was moved to the mutex's wait list, and has only just
+		been unblocked because the mutex was given, so the mutex will normally
+		be available now. */
+		while( xSemaphoreTake( pxCondVar->xMutex, portMAX_DELAY ) != pdPASS )
+		{
+			/* Only reached if INCLUDE_vTaskSuspend is 0, in which case
+			portMAX_DELAY is not an indefinite wait. */
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vCondVarSignal( CondVarHandle_t xCondVar )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+
+	configASSERT( pxCondVar );
+
+	taskENTER_CRITICAL();
+	{
+		traceCONDVAR_SIGNAL( pxCondVar );
+
+		if( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaitingForSignal ) ) == pdFALSE )
+		{
+			if( xQueueMoveWaiterToMutex( &( pxCondVar->xTasksWaitingForSignal ), pxCondVar->xMutex ) != pdFALSE )
+			{
+				/* The yield will not be performed until the critical section
+				is exited. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vCondVarBroadcast( CondVarHandle_t xCondVar )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxCondVar );
+
+	taskENTER_CRITICAL();
+	{
+		traceCONDVAR_BROADCAST( pxCondVar );
+
+		/* If the mutex is held every waiting task is moved to the mutex's wait
+		list, where they remain in priority order, so the mutex is then passed
+		from one to the next without any of them running early. */
+		while( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaitingForSignal ) ) == pdFALSE )
+		{
+			if( xQueueMoveWaiterToMutex( &( pxCondVar->xTasksWaitingForSignal ), pxCondVar->xMutex ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xYieldRequired != pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vCondVarDelete( CondVarHandle_t xCondVar )
+{
+CondVar_t * const pxCondVar = ( CondVar_t * ) xCondVar;
+
+	configASSERT( pxCondVar );
+	configASSERT( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaitingForSignal ) ) != pdFALSE );
+
+	traceCONDVAR_DELETE( pxCondVar );
+	vPortFree( pxCondVar );
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include mutex functionality.  If you want to include condition variables then
+ensure configUSE_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MUTEXES == 1 */
+
+
@@ -87,14 +87,28 @@ header files above, but not in this file, in order to generate the correct
 privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
 
-#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( configUSE_TIMERS == 0 )
+#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( configUSE_TIMERS == 0 ) && ( configUSE_EVENT_GROUP_DIRECT_ISR == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xEventGroupSetBitFromISR() function available.
 #endif
 
-#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 0 )
+#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 0 ) && ( configUSE_EVENT_GROUP_DIRECT_ISR == 0 )
 	#error INCLUDE_xTimerPendFunctionCall must also be set to one to make the xEventGroupSetBitFromISR() function available.
 #endif
 
+/* When configUSE_EVENT_GROUP_DIRECT_ISR is 1 interrupts access the event bits
+and wait lists directly, so task level code must also protect them with a
+critical section - the scheduler lock alone only keeps other tasks out.  The
+critical sections are nested inside the scheduler lock, which is still needed
+because vTaskPlaceOnUnorderedEventList() and
+xTaskRemoveFromUnorderedEventList() manipulate the ready and delayed lists. */
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+	#define eventENTER_CRITICAL()	taskENTER_CRITICAL()
+	#define eventEXIT_CRITICAL()	taskEXIT_CRITICAL()
+#else
+	#define eventENTER_CRITICAL()
+	#define eventEXIT_CRITICAL()
+#endif
+
 /* The following bit fields convey control information in a task's event list
 item value.  It is important they don't clash with the
 taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
@@ -113,7 +127,8 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 typedef struct xEventGroupDefinition
 {
 	EventBits_t uxEventBits;
-	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
+	List_t xTasksWaitingForBits[ configEVENT_GROUP_WAIT_LISTS ];	/*< Lists of tasks waiting for a bit to be set, indexed by the bit each task is keyed on. */
+	EventBits_t uxWaitListInterest[ configEVENT_GROUP_WAIT_LISTS ];	/*< For each list, a superset of the bits whose setting could unblock a task in that list. */
 
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxEventGroupNumber;
@@ -133,17 +148,69 @@ typedef struct xEventGroupDefinition
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits );
 
+/*
+ * Waiting tasks are spread over configEVENT_GROUP_WAIT_LISTS lists so
+ * xEventGroupSetBits() only has to visit the lists that hold tasks that could
+ * be unblocked by the bits being set.  A task is keyed on a single bit, and
+ * placed in the list that bit maps to:
+ *
+ * + A task waiting for any of its bits is keyed on the lowest bit it is
+ *   waiting for, and adds all the bits it is waiting for to the list's
+ *   interest mask.
+ *
+ * + A task waiting for all of its bits is keyed on one of its bits that is
+ *   currently clear, and adds only that bit to the list's interest mask - its
+ *   wait condition cannot be met until that bit is set.  If the key bit is set
+ *   but other bits are still clear the task is re-keyed on one of those.
+ *
+ * Interest masks are only ever made smaller when the list is scanned, so they
+ * can contain stale bits for tasks that have since timed out - that costs an
+ * unnecessary scan, never a missed unblock.
+ */
+static UBaseType_t prvGetWaitListIndex( EventBits_t uxKeyBits );
+static EventBits_t prvGetKeyBit( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsWaitedFor, const EventBits_t uxControlBits );
+
+/*
+ * Place the calling task in the wait list that matches its key bit and update
+ * the interest mask of that list.  Must be called with the scheduler
+ * suspended.
+ */
+static void prvPlaceOnWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor, const EventBits_t uxControlBits, const TickType_t xTicksToWait );
+
+/*
+ * Returns pdTRUE if configUSE_EVENT_GROUP_DIRECT_ISR is 1 and
+ * configEVENT_GROUP_MAX_WAITERS tasks are already blocked on the event group,
+ * in which case the calling task must not block.  Must be called with the
+ * scheduler suspended.
+ */
+static BaseType_t prvWaitListFull( EventGroup_t *pxEventBits );
+
+/*
+ * Set uxBitsToSet in the event group then unblock any tasks whose wait
+ * condition is now met.  Must be called with the scheduler suspended, or with
+ * xFromISR set to pdTRUE and interrupts masked.  Returns pdTRUE if a task with
+ * a priority above the calling task was unblocked.
+ */
+static BaseType_t prvSetBitsAndUnblock( EventGroup_t *pxEventBits, const EventBits_t uxBitsToSet, const BaseType_t xFromISR );
+
 /*-----------------------------------------------------------*/
 
 EventGroupHandle_t xEventGroupCreate( void )
 {
 EventGroup_t *pxEventBits;
+UBaseType_t ux;
 
 	pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
 	if( pxEventBits != NULL )
 	{
 		pxEventBits->uxEventBits = 0;
-		vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+
+		for( ux = ( UBaseType_t ) 0; ux < ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS; ux++ )
+		{
+			vListInitialise( &( pxEventBits->xTasksWaitingForBits[ ux ] ) );
+			pxEventBits->uxWaitListInterest[ ux ] = 0;
+		}
+
 		traceEVENT_GROUP_CREATE( pxEventBits );
 	}
 	else
@@ -171,6 +238,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	eventENTER_CRITICAL();
 	{
 		uxOriginalBitValue = pxEventBits->uxEventBits;
 
@@ -189,6 +257,20 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 		}
 		else
 		{
+			if( ( xTicksToWait != ( TickType_t ) 0 ) && ( prvWaitListFull( pxEventBits ) != pdFALSE ) )
+			{
+				/* The maximum number of tasks are already blocked on the event
+				group, so the call returns as if the block time had expired.
+				A task that waits indefinitely does not expect that. */
+				traceEVENT_GROUP_WAIT_LIST_FULL( xEventGroup );
+				configASSERT( xTicksToWait != portMAX_DELAY );
+				xTicksToWait = ( TickType_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
 			if( xTicksToWait != ( TickType_t ) 0 )
 			{
 				traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor );
@@ -196,7 +278,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				/* Store the bits that the calling task is waiting for in the
 				task's event list item so the kernel knows when a match is
 				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				prvPlaceOnWaitList( pxEventBits, uxBitsToWaitFor, ( eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -207,11 +289,13 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			else
 			{
 				/* The rendezvous bits were not set, but no block time was
-				specified - just return the current event bit value. */
+				specified, or the wait list is full - just return the current
+				event bit value. */
 				uxReturn = pxEventBits->uxEventBits;
 			}
 		}
 	}
+	eventEXIT_CRITICAL();
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -290,6 +374,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	eventENTER_CRITICAL();
 	{
 		const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -319,6 +404,17 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			specified, so just return the current value. */
 			uxReturn = uxCurrentEventBits;
 		}
+		else if( prvWaitListFull( pxEventBits ) != pdFALSE )
+		{
+			/* The wait condition has not been met, but the maximum number of
+			tasks are already blocked on the event group, so return the current
+			value as if the block time had expired.  A task that waits
+			indefinitely does not expect that. */
+			traceEVENT_GROUP_WAIT_LIST_FULL( xEventGroup );
+			configASSERT( xTicksToWait != portMAX_DELAY );
+			uxReturn = uxCurrentEventBits;
+			xTicksToWait = ( TickType_t ) 0;
+		}
 		else
 		{
 			/* The task is going to block to wait for its required bits to be
@@ -346,7 +442,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Store the bits that the calling task is waiting for in the
 			task's event list item so the kernel knows when a match is
 			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			prvPlaceOnWaitList( pxEventBits, uxBitsToWaitFor, uxControlBits, xTicksToWait );
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -356,6 +452,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
 		}
 	}
+	eventEXIT_CRITICAL();
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -446,7 +543,34 @@ EventBits_t uxReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+		system call interrupt priority. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+
+			/* Clearing bits cannot unblock a task, so no wait list needs to
+			be inspected. */
+			pxEventBits->uxEventBits &= ~uxBitsToClear;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pdPASS;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
 	{
@@ -479,30 +603,143 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t *pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
+	eventENTER_CRITICAL();
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
+		/* Any task unblocked here is placed in the ready list, and the yield
+		is performed by xTaskResumeAll() if necessary. */
+		( void ) prvSetBitsAndUnblock( pxEventBits, uxBitsToSet, pdFALSE );
+	}
+	eventEXIT_CRITICAL();
+	( void ) xTaskResumeAll();
+
+	return pxEventBits->uxEventBits;
+}
+/*-----------------------------------------------------------*/
+
+void vEventGroupDelete( EventGroupHandle_t xEventGroup )
+{
+EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+const List_t *pxTasksWaitingForBits;
+UBaseType_t ux;
+
+	vTaskSuspendAll();
+	eventENTER_CRITICAL();
+	{
+		traceEVENT_GROUP_DELETE( xEventGroup );
+
+		for( ux = ( UBaseType_t ) 0; ux < ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS; ux++ )
+		{
+			pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits[ ux ] );
+
+			while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+			{
+				/* Unblock the task, returning 0 as the event list is being
+				deleted and	cannot therefore have any bits set. */
+				configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+				( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+			}
+		}
+	}
+	eventEXIT_CRITICAL();
+
+	/* No interrupt can be waiting on the event group, so it is now safe to
+	free it. */
+	vPortFree( pxEventBits );
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+/* For internal use only - execute a 'set bits' command that was pended from
+an interrupt. */
+void vEventGroupSetBitsCallback( void *pvEventGroup, const uint32_t ulBitsToSet )
+{
+	( void ) xEventGroupSetBits( pvEventGroup, ( EventBits_t ) ulBitsToSet );
+}
+/*-----------------------------------------------------------*/
+
+/* For internal use only - execute a 'clear bits' command that was pended from
+an interrupt. */
+void vEventGroupClearBitsCallback( void *pvEventGroup, const uint32_t ulBitsToClear )
+{
+	( void ) xEventGroupClearBits( pvEventGroup, ( EventBits_t ) ulBitsToClear );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+{
+BaseType_t xWaitConditionMet = pdFALSE;
+
+	if( xWaitForAllBits == pdFALSE )
+	{
+		/* Task only has to wait for one bit within uxBitsToWaitFor to be
+		set.  Is one already set? */
+		if( ( uxCurrentEventBits & uxBitsToWaitFor ) != ( EventBits_t ) 0 )
+		{
+			xWaitConditionMet = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* Task has to wait for all the bits in uxBitsToWaitFor to be set.
+		Are they set already? */
+		if( ( uxCurrentEventBits & uxBitsToWaitFor ) == uxBitsToWaitFor )
+		{
+			xWaitConditionMet = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xWaitConditionMet;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSetBitsAndUnblock( EventGroup_t *pxEventBits, const EventBits_t uxBitsToSet, const BaseType_t xFromISR )
+{
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd;
+List_t *pxList;
+EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxKeyBit, uxInterest;
+BaseType_t xMatchFound = pdFALSE, xHigherPriorityTaskWoken = pdFALSE;
+UBaseType_t uxList, uxNewList;
+
+	/* Set the bits. */
+	pxEventBits->uxEventBits |= uxBitsToSet;
+
+	/* See if the new bit value should unblock any tasks.  Only the lists
+	that contain a task with an interest in one of the bits being set need
+	to be inspected. */
+	for( uxList = ( UBaseType_t ) 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS; uxList++ )
+	{
+		if( ( pxEventBits->uxWaitListInterest[ uxList ] & uxBitsToSet ) == ( EventBits_t ) 0 )
+		{
+			continue;
+		}
+
+		pxList = &( pxEventBits->xTasksWaitingForBits[ uxList ] );
+		pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 		pxListItem = listGET_HEAD_ENTRY( pxList );
 
-		/* Set the bits. */
-		pxEventBits->uxEventBits |= uxBitsToSet;
+		/* The interest mask of the list is rebuilt from the tasks that
+		remain in it. */
+		uxInterest = 0;
 
-		/* See if the new bit value should unblock any tasks. */
 		while( pxListItem != pxListEnd )
 		{
 			pxNext = listGET_NEXT( pxListItem );
@@ -552,100 +789,214 @@ BaseType_t xMatchFound = pdFALSE;
 				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
 				that is was unblocked due to its required bits matching, rather
 				than because it timed out. */
-				( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+				{
+					if( xFromISR != pdFALSE )
+					{
+						if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+						{
+							xHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+					}
+				}
+				#else
+				{
+					( void ) xFromISR;
+					( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				}
+				#endif
+			}
+			else if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+			{
+				/* The task is still waiting for some of its bits.  Its key
+				bit may have just been set, so key it on a bit that is still
+				clear - moving it to another list if necessary. */
+				uxKeyBit = prvGetKeyBit( pxEventBits->uxEventBits, uxBitsWaitedFor, uxControlBits );
+				uxNewList = prvGetWaitListIndex( uxKeyBit );
+
+				if( uxNewList != uxList )
+				{
+					( void ) uxListRemove( pxListItem );
+					vListInsertEnd( &( pxEventBits->xTasksWaitingForBits[ uxNewList ] ), pxListItem );
+					pxEventBits->uxWaitListInterest[ uxNewList ] |= uxKeyBit;
+				}
+				else
+				{
+					uxInterest |= uxKeyBit;
+				}
+			}
+			else
+			{
+				uxInterest |= uxBitsWaitedFor;
 			}
 
 			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
+			used here as the list item may have been removed from the event
+			list and inserted into the ready/pending reading list, or into
+			another wait list. */
 			pxListItem = pxNext;
 		}
 
-		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-		bit was set in the control word. */
-		pxEventBits->uxEventBits &= ~uxBitsToClear;
+		pxEventBits->uxWaitListInterest[ uxList ] = uxInterest;
 	}
-	( void ) xTaskResumeAll();
 
-	return pxEventBits->uxEventBits;
+	/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+	bit was set in the control word. */
+	pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+	return xHigherPriorityTaskWoken;
 }
 /*-----------------------------------------------------------*/
 
-void vEventGroupDelete( EventGroupHandle_t xEventGroup )
+static UBaseType_t prvGetWaitListIndex( EventBits_t uxKeyBits )
 {
-EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+UBaseType_t uxBitNumber = 0;
 
-	vTaskSuspendAll();
-	{
-		traceEVENT_GROUP_DELETE( xEventGroup );
+	configASSERT( uxKeyBits != ( EventBits_t ) 0 );
 
-		while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
-		{
-			/* Unblock the task, returning 0 as the event list is being deleted
-			and	cannot therefore have any bits set. */
-			configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-			( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
-		}
-
-		vPortFree( pxEventBits );
+	/* Bits are mapped onto the lists in turn, so adjacent bits, which are
+	often used together, end up in different lists. */
+	while( ( uxKeyBits & ( EventBits_t ) 1 ) == ( EventBits_t ) 0 )
+	{
+		uxKeyBits >>= ( EventBits_t ) 1;
+		uxBitNumber++;
 	}
-	( void ) xTaskResumeAll();
+
+	return uxBitNumber % ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS;
 }
 /*-----------------------------------------------------------*/
 
-/* For internal use only - execute a 'set bits' command that was pended from
-an interrupt. */
-void vEventGroupSetBitsCallback( void *pvEventGroup, const uint32_t ulBitsToSet )
+static EventBits_t prvGetKeyBit( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsWaitedFor, const EventBits_t uxControlBits )
 {
-	( void ) xEventGroupSetBits( pvEventGroup, ( EventBits_t ) ulBitsToSet );
+EventBits_t uxCandidates;
+
+	if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+	{
+		/* Only a bit that is not yet set can complete the wait condition.
+		The caller has already established that at least one such bit exists. */
+		uxCandidates = uxBitsWaitedFor & ~uxCurrentEventBits;
+	}
+	else
+	{
+		uxCandidates = uxBitsWaitedFor;
+	}
+
+	configASSERT( uxCandidates != ( EventBits_t ) 0 );
+
+	/* Isolate the lowest set bit. */
+	return uxCandidates & ( ~uxCandidates + ( EventBits_t ) 1 );
 }
 /*-----------------------------------------------------------*/
 
-/* For internal use only - execute a 'clear bits' command that was pended from
-an interrupt. */
-void vEventGroupClearBitsCallback( void *pvEventGroup, const uint32_t ulBitsToClear )
+static void prvPlaceOnWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor, const EventBits_t uxControlBits, const TickType_t xTicksToWait )
 {
-	( void ) xEventGroupClearBits( pvEventGroup, ( EventBits_t ) ulBitsToClear );
+EventBits_t uxKeyBit;
+UBaseType_t uxList;
+
+	/* The caller must have checked there is room for another waiting task. */
+	configASSERT( prvWaitListFull( pxEventBits ) == pdFALSE );
+
+	uxKeyBit = prvGetKeyBit( pxEventBits->uxEventBits, uxBitsToWaitFor, uxControlBits );
+	uxList = prvGetWaitListIndex( uxKeyBit );
+
+	if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+	{
+		pxEventBits->uxWaitListInterest[ uxList ] |= uxKeyBit;
+	}
+	else
+	{
+		pxEventBits->uxWaitListInterest[ uxList ] |= uxBitsToWaitFor;
+	}
+
+	vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits[ uxList ] ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 }
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+static BaseType_t prvWaitListFull( EventGroup_t *pxEventBits )
 {
-BaseType_t xWaitConditionMet = pdFALSE;
+BaseType_t xReturn = pdFALSE;
 
-	if( xWaitForAllBits == pdFALSE )
+	#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
 	{
-		/* Task only has to wait for one bit within uxBitsToWaitFor to be
-		set.  Is one already set? */
-		if( ( uxCurrentEventBits & uxBitsToWaitFor ) != ( EventBits_t ) 0 )
-		{
-			xWaitConditionMet = pdTRUE;
-		}
-		else
+	UBaseType_t ux, uxWaiters = 0;
+
+		/* Interrupts scan the wait lists with interrupts masked, so the number
+		of waiting tasks must be bounded. */
+		for( ux = ( UBaseType_t ) 0; ux < ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS; ux++ )
 		{
-			mtCOVERAGE_TEST_MARKER();
+			uxWaiters += listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBits[ ux ] ) );
 		}
-	}
-	else
-	{
-		/* Task has to wait for all the bits in uxBitsToWaitFor to be set.
-		Are they set already? */
-		if( ( uxCurrentEventBits & uxBitsToWaitFor ) == uxBitsToWaitFor )
+
+		if( uxWaiters >= ( UBaseType_t ) configEVENT_GROUP_MAX_WAITERS )
 		{
-			xWaitConditionMet = pdTRUE;
+			xReturn = pdTRUE;
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
+	#else
+	{
+		( void ) pxEventBits;
+	}
+	#endif
 
-	return xWaitConditionMet;
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+		system call interrupt priority. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		/* The number of tasks that can be waiting on the event group is capped
+		at configEVENT_GROUP_MAX_WAITERS, so the time spent with interrupts
+		masked here is bounded. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+			if( prvSetBitsAndUnblock( pxEventBits, uxBitsToSet, pdTRUE ) != pdFALSE )
+			{
+				if( pxHigherPriorityTaskWoken != NULL )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pdPASS;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
 	{
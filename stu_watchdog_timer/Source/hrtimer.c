@@ -0,0 +1,651 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hrtimer.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include high resolution timer functionality.  This #if is closed at the very
+bottom of this file.  If you want to include high resolution timers then ensure
+configUSE_HRTIMERS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_HRTIMERS == 1 )
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use high resolution timers.
+#endif
+
+/*
+ * The port layer must provide the following to use high resolution timers:
+ *
+ * portHRTIMER_GET_COUNT() - returns the free running 32-bit counter.
+ * portHRTIMER_COUNTS_PER_US - the number of counts per microsecond.
+ * portHRTIMER_MIN_COUNTS - the shortest time into the future for which the
+ *   compare channel can be reliably programmed.
+ * portHRTIMER_SETUP() - configures the compare interrupt, without enabling it.
+ * portHRTIMER_SET_COMPARE( ulCount ) - clears any pending compare interrupt,
+ *   programs the compare channel, and enables the compare interrupt.
+ * portHRTIMER_DISABLE_COMPARE() - disables and clears the compare interrupt.
+ * portHRTIMER_FORCE_INTERRUPT() - makes the compare interrupt pending.
+ *
+ * The compare interrupt must call vHRTimerInterruptHandler(), through a
+ * wrapper that saves and restores the context if the port requires one.
+ */
+
+/* Bits used in the ucStatus member of a timer. */
+#define hrtimerSTATUS_ACTIVE		( ( uint8_t ) 0x01U )
+#define hrtimerSTATUS_PENDING		( ( uint8_t ) 0x02U )
+
+/* Returns pdTRUE if count ulA comes before count ulB.  Correct across counter
+overflow provided the two counts are less than half the counter range apart. */
+#define hrtimerIS_BEFORE( ulA, ulB ) ( ( ( int32_t ) ( ( ulA ) - ( ulB ) ) < 0 ) ? pdTRUE : pdFALSE )
+
+/* The definition of the high resolution timers themselves. */
+typedef struct hrtimerControl
+{
+	const char *pcTimerName;					/*<< Text name.  This is not used by the kernel, it is included simply to make debugging easier. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	struct hrtimerControl *pxNextActive;		/*<< The next timer in the active list, which is ordered by deadline. */
+	struct hrtimerControl *pxNextPending;		/*<< The next timer whose callback is waiting to be executed by the service task. */
+	uint32_t ulDeadline;						/*<< The count at which the timer expires. */
+	uint32_t ulPendingDeadline;					/*<< The deadline at which a pending callback expired, kept separately as the timer may be restarted before the callback executes. */
+	HRTimerCallbackFunction_t pxCallbackFunction;	/*<< The function that will be called when the timer expires. */
+	void *pvTimerID;							/*<< An ID to identify the timer. */
+	uint8_t ucCallFromTask;						/*<< Set to pdTRUE if the callback is executed by the service task. */
+	uint8_t ucStatus;							/*<< hrtimerSTATUS_ bits. */
+} HRTimer_t;
+
+/*lint -e956 A manual analysis and inspection has been used to determine which
+static variables must be declared volatile. */
+
+/* Active timers, ordered by deadline.  The compare channel is programmed for
+the timer at the head of the list. */
+PRIVILEGED_DATA static HRTimer_t * volatile pxActiveTimers = NULL;
+
+/* Timers whose callbacks are waiting to be executed by the service task, in
+the order in which they expired. */
+PRIVILEGED_DATA static HRTimer_t * volatile pxPendingHead = NULL;
+PRIVILEGED_DATA static HRTimer_t * volatile pxPendingTail = NULL;
+
+PRIVILEGED_DATA static TaskHandle_t xHRTimerTaskHandle = NULL;
+
+/* Latency statistics, updated with interrupts masked. */
+PRIVILEGED_DATA static HRTimerStats_t xStats = { 0UL, 0UL, 0UL, 0UL };
+
+/*lint +e956 */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The service task executes the callbacks of timers created with
+ * hrtimerCALL_FROM_TASK.
+ */
+static void prvHRTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a timer into the active list and reprogram the compare channel if the
+ * timer becomes the next to expire.  Must be called with interrupts masked.
+ */
+static void prvInsertActive( HRTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove a timer from the active list if it is in it.  Must be called with
+ * interrupts masked.  The compare channel is not reprogrammed, so removing the
+ * head timer can result in an interrupt that finds nothing to do.
+ */
+static void prvRemoveActive( HRTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add ulLatency to the statistics.  Must be called with interrupts masked.
+ */
+static void prvRecordLatency( const uint32_t ulLatency ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xHRTimerServiceStart( void )
+{
+BaseType_t xReturn;
+
+	configASSERT( xHRTimerTaskHandle == NULL );
+
+	xReturn = xTaskCreate( prvHRTimerTask, "HRTmr", ( uint16_t ) configHRTIMER_TASK_STACK_DEPTH, NULL, ( ( UBaseType_t ) configHRTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, &xHRTimerTaskHandle );
+
+	if( xReturn == pdPASS )
+	{
+		portHRTIMER_SETUP();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+HRTimerHandle_t xHRTimerCreate( const char * const pcTimerName, HRTimerCallbackFunction_t pxCallbackFunction, void * const pvTimerID, const UBaseType_t uxCallFromTask ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+HRTimer_t *pxNewTimer;
+
+	configASSERT( pxCallbackFunction );
+
+	pxNewTimer = ( HRTimer_t * ) pvPortMalloc( sizeof( HRTimer_t ) );
+
+	if( pxNewTimer != NULL )
+	{
+		pxNewTimer->pcTimerName = pcTimerName;
+		pxNewTimer->pxNextActive = NULL;
+		pxNewTimer->pxNextPending = NULL;
+		pxNewTimer->ulDeadline = 0UL;
+		pxNewTimer->ulPendingDeadline = 0UL;
+		pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+		pxNewTimer->pvTimerID = pvTimerID;
+		pxNewTimer->ucCallFromTask = ( uint8_t ) ( ( uxCallFromTask != hrtimerCALL_FROM_ISR ) ? pdTRUE : pdFALSE );
+		pxNewTimer->ucStatus = ( uint8_t ) 0U;
+
+		traceHRTIMER_CREATE( pxNewTimer );
+	}
+	else
+	{
+		traceHRTIMER_CREATE_FAILED();
+	}
+
+	return ( HRTimerHandle_t ) pxNewTimer;
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerStartAt( HRTimerHandle_t xTimer, const uint32_t ulDeadline )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+
+	taskENTER_CRITICAL();
+	{
+		traceHRTIMER_START( pxTimer, ulDeadline );
+
+		prvRemoveActive( pxTimer );
+		pxTimer->ulDeadline = ulDeadline;
+		prvInsertActive( pxTimer );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerStartAtFromISR( HRTimerHandle_t xTimer, const uint32_t ulDeadline )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxTimer );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		traceHRTIMER_START( pxTimer, ulDeadline );
+
+		prvRemoveActive( pxTimer );
+		pxTimer->ulDeadline = ulDeadline;
+		prvInsertActive( pxTimer );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerStop( HRTimerHandle_t xTimer )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+
+	taskENTER_CRITICAL();
+	{
+		traceHRTIMER_STOP( pxTimer );
+		prvRemoveActive( pxTimer );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerStopFromISR( HRTimerHandle_t xTimer )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxTimer );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		traceHRTIMER_STOP( pxTimer );
+		prvRemoveActive( pxTimer );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerDelete( HRTimerHandle_t xTimer )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+HRTimer_t *pxPrevious, *pxIterator;
+
+	configASSERT( pxTimer );
+
+	taskENTER_CRITICAL();
+	{
+		traceHRTIMER_DELETE( pxTimer );
+		prvRemoveActive( pxTimer );
+
+		/* Discard the pending callback, if any. */
+		if( ( pxTimer->ucStatus & hrtimerSTATUS_PENDING ) != 0U )
+		{
+			pxPrevious = NULL;
+			for( pxIterator = pxPendingHead; pxIterator != pxTimer; pxIterator = pxIterator->pxNextPending )
+			{
+				pxPrevious = pxIterator;
+			}
+
+			if( pxPrevious == NULL )
+			{
+				pxPendingHead = pxTimer->pxNextPending;
+			}
+			else
+			{
+				pxPrevious->pxNextPending = pxTimer->pxNextPending;
+			}
+
+			if( pxPendingTail == pxTimer )
+			{
+				pxPendingTail = pxPrevious;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	vPortFree( pxTimer );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHRTimerIsActive( HRTimerHandle_t xTimer )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+
+	/* A single byte read does not need a critical section. */
+	return ( ( pxTimer->ucStatus & hrtimerSTATUS_ACTIVE ) != 0U ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void *pvHRTimerGetTimerID( HRTimerHandle_t xTimer )
+{
+HRTimer_t * const pxTimer = ( HRTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+	return pxTimer->pvTimerID;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulHRTimerGetCount( void )
+{
+	return ( uint32_t ) portHRTIMER_GET_COUNT();
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerGetStats( HRTimerStats_t *pxStats, const BaseType_t xResetStats )
+{
+	configASSERT( pxStats );
+
+	taskENTER_CRITICAL();
+	{
+		*pxStats = xStats;
+
+		if( xResetStats != pdFALSE )
+		{
+			xStats.ulExpiries = 0UL;
+			xStats.ulLastLatency = 0UL;
+			xStats.ulMaxLatency = 0UL;
+			xStats.ulTotalLatency = 0UL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vHRTimerInterruptHandler( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+UBaseType_t uxSavedInterruptStatus;
+HRTimer_t *pxTimer;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+
+	for( ;; )
+	{
+		pxTimer = pxActiveTimers;
+
+		if( pxTimer == NULL )
+		{
+			portHRTIMER_DISABLE_COMPARE();
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* If the next deadline is far enough away then program the compare
+		channel for it and exit.  If it is closer than portHRTIMER_MIN_COUNTS
+		the compare could be missed, so instead wait here until the deadline
+		is reached, which takes no longer than the interrupt entry would. */
+		if( hrtimerIS_BEFORE( portHRTIMER_GET_COUNT() + ( uint32_t ) portHRTIMER_MIN_COUNTS, pxTimer->ulDeadline ) != pdFALSE )
+		{
+			portHRTIMER_SET_COMPARE( pxTimer->ulDeadline );
+			break;
+		}
+		else
+		{
+			while( hrtimerIS_BEFORE( portHRTIMER_GET_COUNT(), pxTimer->ulDeadline ) != pdFALSE )
+			{
+				/* Wait for the deadline. */
+			}
+		}
+
+		pxActiveTimers = pxTimer->pxNextActive;
+		pxTimer->pxNextActive = NULL;
+		pxTimer->ucStatus &= ( uint8_t ) ~hrtimerSTATUS_ACTIVE;
+		traceHRTIMER_EXPIRED( pxTimer );
+
+		if( pxTimer->ucCallFromTask != ( uint8_t ) pdFALSE )
+		{
+			/* Queue the callback for the service task.  If the callback from a
+			previous expiry has not executed yet then the two are merged. */
+			if( ( pxTimer->ucStatus & hrtimerSTATUS_PENDING ) == 0U )
+			{
+				pxTimer->ucStatus |= hrtimerSTATUS_PENDING;
+				pxTimer->ulPendingDeadline = pxTimer->ulDeadline;
+				pxTimer->pxNextPending = NULL;
+
+				if( pxPendingTail == NULL )
+				{
+					pxPendingHead = pxTimer;
+				}
+				else
+				{
+					pxPendingTail->pxNextPending = pxTimer;
+				}
+
+				pxPendingTail = pxTimer;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			vTaskNotifyGiveFromISR( xHRTimerTaskHandle, &xHigherPriorityTaskWoken );
+		}
+		else
+		{
+			prvRecordLatency( portHRTIMER_GET_COUNT() - pxTimer->ulDeadline );
+
+			/* Execute the callback with interrupts unmasked, it may start
+			timers itself. */
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+			{
+				pxTimer->pxCallbackFunction( ( HRTimerHandle_t ) pxTimer, &xHigherPriorityTaskWoken );
+			}
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		}
+	}
+
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHRTimerTask( void *pvParameters )
+{
+HRTimer_t *pxTimer;
+uint32_t ulDeadline = 0UL;
+
+	/* Just to avoid compiler warnings. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		/* Execute every pending callback. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				pxTimer = pxPendingHead;
+
+				if( pxTimer != NULL )
+				{
+					pxPendingHead = pxTimer->pxNextPending;
+
+					if( pxPendingHead == NULL )
+					{
+						pxPendingTail = NULL;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxTimer->pxNextPending = NULL;
+					pxTimer->ucStatus &= ( uint8_t ) ~hrtimerSTATUS_PENDING;
+					ulDeadline = pxTimer->ulPendingDeadline;
+					prvRecordLatency( portHRTIMER_GET_COUNT() - ulDeadline );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( pxTimer == NULL )
+			{
+				break;
+			}
+			else
+			{
+				pxTimer->pxCallbackFunction( ( HRTimerHandle_t ) pxTimer, NULL );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertActive( HRTimer_t * const pxTimer )
+{
+HRTimer_t *pxPrevious = NULL, *pxIterator;
+
+	/* Timers with equal deadlines expire in the order they were started. */
+	for( pxIterator = pxActiveTimers; pxIterator != NULL; pxIterator = pxIterator->pxNextActive )
+	{
+		if( hrtimerIS_BEFORE( pxTimer->ulDeadline, pxIterator->ulDeadline ) != pdFALSE )
+		{
+			break;
+		}
+		else
+		{
+			pxPrevious = pxIterator;
+		}
+	}
+
+	pxTimer->pxNextActive = pxIterator;
+	pxTimer->ucStatus |= hrtimerSTATUS_ACTIVE;
+
+	if( pxPrevious == NULL )
+	{
+		/* The timer is now the next to expire. */
+		pxActiveTimers = pxTimer;
+
+		if( hrtimerIS_BEFORE( portHRTIMER_GET_COUNT() + ( uint32_t ) portHRTIMER_MIN_COUNTS, pxTimer->ulDeadline ) != pdFALSE )
+		{
+			portHRTIMER_SET_COMPARE( pxTimer->ulDeadline );
+		}
+		else
+		{
+			/* Too close to program the compare reliably - let the interrupt
+			handler deal with it straight away. */
+			portHRTIMER_FORCE_INTERRUPT();
+		}
+	}
+	else
+	{
+		pxPrevious->pxNextActive = pxTimer;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveActive( HRTimer_t * const pxTimer )
+{
+HRTimer_t *pxPrevious = NULL, *pxIterator;
+
+	if( ( pxTimer->ucStatus & hrtimerSTATUS_ACTIVE ) != 0U )
+	{
+		for( pxIterator = pxActiveTimers; pxIterator != pxTimer; pxIterator = pxIterator->pxNextActive )
+		{
+			configASSERT( pxIterator );
+			pxPrevious = pxIterator;
+		}
+
+		if( pxPrevious == NULL )
+		{
+			pxActiveTimers = pxTimer->pxNextActive;
+		}
+		else
+		{
+			pxPrevious->pxNextActive = pxTimer->pxNextActive;
+		}
+
+		pxTimer->pxNextActive = NULL;
+		pxTimer->ucStatus &= ( uint8_t ) ~hrtimerSTATUS_ACTIVE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordLatency( const uint32_t ulLatency )
+{
+	( xStats.ulExpiries )++;
+	xStats.ulLastLatency = ulLatency;
+	xStats.ulTotalLatency += ulLatency;
+
+	if( ulLatency > xStats.ulMaxLatency )
+	{
+		xStats.ulMaxLatency = ulLatency;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include high resolution timer functionality.  If you want to include high
+resolution timers then ensure configUSE_HRTIMERS is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_HRTIMERS == 1 */
+
@@ -279,6 +279,54 @@ extern "C" {
 
 #endif /* configUSE_TIMERS */
 
+#ifndef configUSE_TIMER_DIRECT_COMMANDS
+	#define configUSE_TIMER_DIRECT_COMMANDS 0
+#endif
+
+#ifndef configTIMER_COMMAND_BATCH_LENGTH
+	#define configTIMER_COMMAND_BATCH_LENGTH 1
+#endif
+
+#if ( configTIMER_COMMAND_BATCH_LENGTH < 1 )
+	#error configTIMER_COMMAND_BATCH_LENGTH must be at least 1.
+#endif
+
+#ifndef configUSE_TIMER_STATS
+	#define configUSE_TIMER_STATS 0
+#endif
+
+#ifndef configTIMER_STATS_LATENESS_BUCKETS
+	#define configTIMER_STATS_LATENESS_BUCKETS 8
+#endif
+
+#if ( configTIMER_STATS_LATENESS_BUCKETS < 1 )
+	#error configTIMER_STATS_LATENESS_BUCKETS must be at least 1.
+#endif
+
+#ifndef configUSE_TIMER_CATCH_UP_POLICIES
+	#define configUSE_TIMER_CATCH_UP_POLICIES 0
+#endif
+
+#ifndef configUSE_HRTIMERS
+	#define configUSE_HRTIMERS 0
+#endif
+
+#if ( configUSE_HRTIMERS == 1 )
+
+	#ifndef portHRTIMER_GET_COUNT
+		#error If configUSE_HRTIMERS is set to 1 then the port must provide the portHRTIMER_ macros.  See hrtimer.c.
+	#endif /* portHRTIMER_GET_COUNT */
+
+	#ifndef configHRTIMER_TASK_PRIORITY
+		#define configHRTIMER_TASK_PRIORITY ( configMAX_PRIORITIES - 1 )
+	#endif
+
+	#ifndef configHRTIMER_TASK_STACK_DEPTH
+		#define configHRTIMER_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+	#endif
+
+#endif /* configUSE_HRTIMERS */
+
 #ifndef INCLUDE_xTaskGetSchedulerState
 	#define INCLUDE_xTaskGetSchedulerState 0
 #endif
@@ -553,10 +601,35 @@ extern "C" {
 	#define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )
 #endif
 
+#ifndef traceTIMER_LATENESS
+	/* Called before each timer callback, with the number of ticks between the
+	timer's expiry time and the callback. */
+	#define traceTIMER_LATENESS( pxTimer, xLateness )
+#endif
+
+#ifndef traceTIMER_PERIODS_SKIPPED
+	/* Called when the catch-up policy of an auto-reload timer causes the
+	callbacks for xSkippedPeriods periods not to be executed. */
+	#define traceTIMER_PERIODS_SKIPPED( pxTimer, xSkippedPeriods )
+#endif
+
+#ifndef traceTIMER_COMMAND_QUEUE_OVERRUN
+	/* Called when a command or pended function call could not be posted to the
+	timer queue because the queue was full. */
+	#define traceTIMER_COMMAND_QUEUE_OVERRUN()
+#endif
+
 #ifndef traceMALLOC
     #define traceMALLOC( pvAddress, uiSize )
 #endif
 
+#ifndef traceMALLOC_REQUESTED
+	/* Called after traceMALLOC() with the size the caller passed to
+	pvPortMalloc().  The size passed to traceMALLOC() by some heap
+	implementations includes their own header and alignment padding. */
+	#define traceMALLOC_REQUESTED( pvAddress, uiRequestedSize )
+#endif
+
 #ifndef traceFREE
     #define traceFREE( pvAddress, uiSize )
 #endif
@@ -577,6 +650,13 @@ extern "C" {
 	#define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred ) ( void ) xTimeoutOccurred
 #endif
 
+#ifndef traceEVENT_GROUP_WAIT_LIST_FULL
+	/* Called when xEventGroupWaitBits() or xEventGroupSync() cannot block
+	because configEVENT_GROUP_MAX_WAITERS tasks are already blocked on the
+	event group. */
+	#define traceEVENT_GROUP_WAIT_LIST_FULL( xEventGroup )
+#endif
+
 #ifndef traceEVENT_GROUP_WAIT_BITS_BLOCK
 	#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )
 #endif
@@ -645,6 +725,238 @@ extern "C" {
 	#define traceTASK_NOTIFY_GIVE_FROM_ISR()
 #endif
 
+#ifndef traceBROADCAST_CREATE
+	#define traceBROADCAST_CREATE( pxBroadcast )
+#endif
+
+#ifndef traceBROADCAST_CREATE_FAILED
+	#define traceBROADCAST_CREATE_FAILED()
+#endif
+
+#ifndef traceBROADCAST_PUBLISH
+	#define traceBROADCAST_PUBLISH( pxBroadcast )
+#endif
+
+#ifndef traceBROADCAST_PUBLISH_FROM_ISR
+	#define traceBROADCAST_PUBLISH_FROM_ISR( pxBroadcast )
+#endif
+
+#ifndef traceBROADCAST_RECEIVE
+	#define traceBROADCAST_RECEIVE( pxBroadcast, pxSubscriber )
+#endif
+
+#ifndef traceBROADCAST_RECEIVE_FAILED
+	#define traceBROADCAST_RECEIVE_FAILED( pxBroadcast, pxSubscriber )
+#endif
+
+#ifndef traceBROADCAST_OVERRUN
+	#define traceBROADCAST_OVERRUN( pxBroadcast, pxSubscriber, uxItemsLost )
+#endif
+
+#ifndef traceBLOCKING_ON_BROADCAST_RECEIVE
+	#define traceBLOCKING_ON_BROADCAST_RECEIVE( pxBroadcast, pxSubscriber )
+#endif
+
+#ifndef traceBROADCAST_DELETE
+	#define traceBROADCAST_DELETE( pxBroadcast )
+#endif
+
+#ifndef traceMAILBOX_CREATE
+	#define traceMAILBOX_CREATE( pxMailbox )
+#endif
+
+#ifndef traceMAILBOX_CREATE_FAILED
+	#define traceMAILBOX_CREATE_FAILED()
+#endif
+
+#ifndef traceMAILBOX_WRITE
+	#define traceMAILBOX_WRITE( pxMailbox )
+#endif
+
+#ifndef traceMAILBOX_WRITE_FROM_ISR
+	#define traceMAILBOX_WRITE_FROM_ISR( pxMailbox )
+#endif
+
+#ifndef traceMAILBOX_DELETE
+	#define traceMAILBOX_DELETE( pxMailbox )
+#endif
+
+#ifndef traceMEMPOOL_CREATE
+	#define traceMEMPOOL_CREATE( pxMemPool )
+#endif
+
+#ifndef traceMEMPOOL_CREATE_FAILED
+	#define traceMEMPOOL_CREATE_FAILED()
+#endif
+
+#ifndef traceMEMPOOL_ALLOC
+	#define traceMEMPOOL_ALLOC( pxMemPool, pvBlock )
+#endif
+
+#ifndef traceMEMPOOL_ALLOC_FAILED
+	#define traceMEMPOOL_ALLOC_FAILED( pxMemPool )
+#endif
+
+#ifndef traceMEMPOOL_FREE
+	#define traceMEMPOOL_FREE( pxMemPool, pvBlock )
+#endif
+
+#ifndef traceBLOCKING_ON_MEMPOOL_ALLOC
+	#define traceBLOCKING_ON_MEMPOOL_ALLOC( pxMemPool )
+#endif
+
+#ifndef traceMEMPOOL_DELETE
+	#define traceMEMPOOL_DELETE( pxMemPool )
+#endif
+
+#ifndef traceARENA_CREATE
+	#define traceARENA_CREATE( pxArena )
+#endif
+
+#ifndef traceARENA_CREATE_FAILED
+	#define traceARENA_CREATE_FAILED()
+#endif
+
+#ifndef traceARENA_ALLOC
+	#define traceARENA_ALLOC( pxArena, pvBlock )
+#endif
+
+#ifndef traceARENA_ALLOC_FAILED
+	#define traceARENA_ALLOC_FAILED( pxArena )
+#endif
+
+#ifndef traceARENA_GROW
+	#define traceARENA_GROW( pxArena, xChunkSize )
+#endif
+
+#ifndef traceARENA_RESET
+	#define traceARENA_RESET( pxArena )
+#endif
+
+#ifndef traceARENA_DELETE
+	#define traceARENA_DELETE( pxArena )
+#endif
+
+#ifndef traceBARRIER_CREATE
+	#define traceBARRIER_CREATE( pxBarrier )
+#endif
+
+#ifndef traceBARRIER_CREATE_FAILED
+	#define traceBARRIER_CREATE_FAILED()
+#endif
+
+#ifndef traceBARRIER_WAIT
+	#define traceBARRIER_WAIT( pxBarrier )
+#endif
+
+#ifndef traceBLOCKING_ON_BARRIER_WAIT
+	#define traceBLOCKING_ON_BARRIER_WAIT( pxBarrier )
+#endif
+
+#ifndef traceBARRIER_RELEASE
+	#define traceBARRIER_RELEASE( pxBarrier )
+#endif
+
+#ifndef traceBARRIER_WAIT_FAILED
+	#define traceBARRIER_WAIT_FAILED( pxBarrier )
+#endif
+
+#ifndef traceBARRIER_DELETE
+	#define traceBARRIER_DELETE( pxBarrier )
+#endif
+
+#ifndef traceRWLOCK_CREATE
+	#define traceRWLOCK_CREATE( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_CREATE_FAILED
+	#define traceRWLOCK_CREATE_FAILED()
+#endif
+
+#ifndef traceRWLOCK_READ_LOCK
+	#define traceRWLOCK_READ_LOCK( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_READ_LOCK_FAILED
+	#define traceRWLOCK_READ_LOCK_FAILED( pxRWLock )
+#endif
+
+#ifndef traceBLOCKING_ON_RWLOCK_READ
+	#define traceBLOCKING_ON_RWLOCK_READ( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_READ_UNLOCK
+	#define traceRWLOCK_READ_UNLOCK( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_WRITE_LOCK
+	#define traceRWLOCK_WRITE_LOCK( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_WRITE_LOCK_FAILED
+	#define traceRWLOCK_WRITE_LOCK_FAILED( pxRWLock )
+#endif
+
+#ifndef traceBLOCKING_ON_RWLOCK_WRITE
+	#define traceBLOCKING_ON_RWLOCK_WRITE( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_WRITE_UNLOCK
+	#define traceRWLOCK_WRITE_UNLOCK( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_DELETE
+	#define traceRWLOCK_DELETE( pxRWLock )
+#endif
+
+#ifndef traceCONDVAR_CREATE
+	#define traceCONDVAR_CREATE( pxCondVar )
+#endif
+
+#ifndef traceCONDVAR_CREATE_FAILED
+	#define traceCONDVAR_CREATE_FAILED()
+#endif
+
+#ifndef traceBLOCKING_ON_CONDVAR_WAIT
+	#define traceBLOCKING_ON_CONDVAR_WAIT( pxCondVar )
+#endif
+
+#ifndef traceCONDVAR_SIGNAL
+	#define traceCONDVAR_SIGNAL( pxCondVar )
+#endif
+
+#ifndef traceCONDVAR_BROADCAST
+	#define traceCONDVAR_BROADCAST( pxCondVar )
+#endif
+
+#ifndef traceCONDVAR_DELETE
+	#define traceCONDVAR_DELETE( pxCondVar )
+#endif
+
+#ifndef traceHRTIMER_CREATE
+	#define traceHRTIMER_CREATE( pxNewTimer )
+#endif
+
+#ifndef traceHRTIMER_CREATE_FAILED
+	#define traceHRTIMER_CREATE_FAILED()
+#endif
+
+#ifndef traceHRTIMER_START
+	#define traceHRTIMER_START( pxTimer, ulDeadline )
+#endif
+
+#ifndef traceHRTIMER_STOP
+	#define traceHRTIMER_STOP( pxTimer )
+#endif
+
+#ifndef traceHRTIMER_EXPIRED
+	#define traceHRTIMER_EXPIRED( pxTimer )
+#endif
+
+#ifndef traceHRTIMER_DELETE
+	#define traceHRTIMER_DELETE( pxTimer )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
@@ -680,7 +992,7 @@ extern "C" {
 #endif
 
 #ifndef pvPortMallocAligned
-	#define pvPortMallocAligned( x, puxStackBuffer ) ( ( ( puxStackBuffer ) == NULL ) ? ( pvPortMalloc( ( x ) ) ) : ( puxStackBuffer ) )
+	#define pvPortMallocAligned( x, puxStackBuffer ) ( ( ( puxStackBuffer ) == NULL ) ? ( pvPortMallocStack( ( x ) ) ) : ( puxStackBuffer ) )
 #endif
 
 #ifndef vPortFreeAligned
@@ -715,6 +1027,34 @@ extern "C" {
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+#ifndef configUSE_QUEUE_STATS
+	#define configUSE_QUEUE_STATS 0
+#endif
+
+#ifndef configQUEUE_STATS_WAIT_BUCKETS
+	#define configQUEUE_STATS_WAIT_BUCKETS 8
+#endif
+
+#if ( configQUEUE_STATS_WAIT_BUCKETS < 1 )
+	#error configQUEUE_STATS_WAIT_BUCKETS must be at least 1
+#endif
+
+#ifndef configEVENT_GROUP_WAIT_LISTS
+	#define configEVENT_GROUP_WAIT_LISTS 4
+#endif
+
+#if ( configEVENT_GROUP_WAIT_LISTS < 1 )
+	#error configEVENT_GROUP_WAIT_LISTS must be at least 1
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_ISR
+	#define configUSE_EVENT_GROUP_DIRECT_ISR 0
+#endif
+
+#ifndef configEVENT_GROUP_MAX_WAITERS
+	#define configEVENT_GROUP_MAX_WAITERS 8
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -763,10 +1103,163 @@ extern "C" {
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
 
+#ifndef configTLSF_MAX_BLOCK_SIZE_BITS
+	/* Only used by heap_6.c.  Blocks, and so allocations, must be smaller than
+	2^configTLSF_MAX_BLOCK_SIZE_BITS bytes. */
+	#define configTLSF_MAX_BLOCK_SIZE_BITS 20
+#endif
+
+#ifndef configUSE_HEAP_SLABS
+	#define configUSE_HEAP_SLABS 0
+#endif
+
+#if ( configUSE_HEAP_SLABS == 1 )
+
+	/* Size class n of the heap_4.c and heap_5.c slab caches serves requests of
+	up to ( n + 1 ) * configHEAP_SLAB_GRANULARITY bytes. */
+	#ifndef configHEAP_SLAB_GRANULARITY
+		#define configHEAP_SLAB_GRANULARITY 16
+	#endif
+
+	#ifndef configHEAP_SLAB_CLASS_COUNT
+		#define configHEAP_SLAB_CLASS_COUNT 8
+	#endif
+
+	/* The number of objects taken from the heap, as one chunk, each time a
+	class is empty.  The chunk is returned to the heap when none of its objects
+	are in use. */
+	#ifndef configHEAP_SLAB_REFILL_OBJECTS
+		#define configHEAP_SLAB_REFILL_OBJECTS 4
+	#endif
+
+	#if ( configHEAP_SLAB_CLASS_COUNT < 1 ) || ( configHEAP_SLAB_REFILL_OBJECTS < 1 )
+		#error configHEAP_SLAB_CLASS_COUNT and configHEAP_SLAB_REFILL_OBJECTS must be at least 1
+	#endif
+
+#endif /* configUSE_HEAP_SLABS */
+
+#ifndef configUSE_HEAP_ISR_CACHE
+	#define configUSE_HEAP_ISR_CACHE 0
+#endif
+
+#if ( configUSE_HEAP_ISR_CACHE == 1 )
+
+	#if ( configUSE_HEAP_SLABS != 1 )
+		#error configUSE_HEAP_ISR_CACHE requires configUSE_HEAP_SLABS to be set to 1
+	#endif
+
+	/* The number of objects each size class holds for pvPortMallocFromISR()
+	once it has been requested from an interrupt. */
+	#ifndef configHEAP_ISR_CACHE_OBJECTS
+		#define configHEAP_ISR_CACHE_OBJECTS 2
+	#endif
+
+	/* A mask of the size classes, bit 0 being class 0, that are filled for
+	pvPortMallocFromISR() by the first call to pvPortMalloc() rather than when
+	they are first requested from an interrupt.  Only the first 32 classes can
+	be included. */
+	#ifndef configHEAP_ISR_CACHE_CLASSES
+		#define configHEAP_ISR_CACHE_CLASSES 0
+	#endif
+
+#endif /* configUSE_HEAP_ISR_CACHE */
+
+#ifndef configUSE_HEAP_ACCOUNTING
+	#define configUSE_HEAP_ACCOUNTING 0
+#endif
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+	/* The number of tasks whose heap usage heap_4.c and heap_5.c can record at
+	once. */
+	#ifndef configHEAP_ACCOUNTING_MAX_TASKS
+		#define configHEAP_ACCOUNTING_MAX_TASKS 16
+	#endif
+
+	#ifndef configUSE_HEAP_QUOTA_HOOK
+		#define configUSE_HEAP_QUOTA_HOOK 0
+	#endif
+
+	/* Heap accounting charges blocks to the calling task, once the scheduler
+	has started. */
+	#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+		#error configUSE_HEAP_ACCOUNTING requires INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES to be set to 1
+	#endif
+
+	#if ( INCLUDE_xTaskGetSchedulerState != 1 ) && ( configUSE_TIMERS != 1 )
+		#error configUSE_HEAP_ACCOUNTING requires INCLUDE_xTaskGetSchedulerState or configUSE_TIMERS to be set to 1
+	#endif
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+
+#ifndef configUSE_HEAP_CANARIES
+	#define configUSE_HEAP_CANARIES 0
+#endif
+
+#ifndef configHEAP_VERIFY_BLOCKS_PER_STEP
+	/* The number of free blocks xPortHeapVerifyStep() checks each time it is
+	called from the idle task. */
+	#define configHEAP_VERIFY_BLOCKS_PER_STEP 4
+#endif
+
+#ifndef configUSE_HEAP_REGION_CLASSES
+	#define configUSE_HEAP_REGION_CLASSES 0
+#endif
+
+#if ( configUSE_HEAP_REGION_CLASSES == 1 )
+
+	/* The most regions that can be passed to vPortDefineHeapRegions(). */
+	#ifndef configHEAP_MAX_REGIONS
+		#define configHEAP_MAX_REGIONS 4
+	#endif
+
+	/* Regions are tagged with a class less than configHEAP_REGION_CLASS_COUNT. */
+	#ifndef configHEAP_REGION_CLASS_COUNT
+		#define configHEAP_REGION_CLASS_COUNT 3
+	#endif
+
+	/* The class pvPortMalloc() prefers. */
+	#ifndef configHEAP_DEFAULT_REGION_CLASS
+		#define configHEAP_DEFAULT_REGION_CLASS portHEAP_CLASS_BULK
+	#endif
+
+	/* The class task control blocks and stacks prefer. */
+	#ifndef configHEAP_KERNEL_REGION_CLASS
+		#define configHEAP_KERNEL_REGION_CLASS portHEAP_CLASS_FAST
+	#endif
+
+#endif /* configUSE_HEAP_REGION_CLASSES */
+
+#ifndef pvPortMallocTCB
+	#if ( configUSE_HEAP_REGION_CLASSES == 1 )
+		#define pvPortMallocTCB( x ) pvPortMallocFromClass( ( x ), configHEAP_KERNEL_REGION_CLASS, pdTRUE )
+	#else
+		#define pvPortMallocTCB( x ) pvPortMalloc( ( x ) )
+	#endif
+#endif
+
+#ifndef pvPortMallocStack
+	#if ( configUSE_HEAP_REGION_CLASSES == 1 )
+		#define pvPortMallocStack( x ) pvPortMallocFromClass( ( x ), configHEAP_KERNEL_REGION_CLASS, pdTRUE )
+	#else
+		#define pvPortMallocStack( x ) pvPortMalloc( ( x ) )
+	#endif
+#endif
+
 #ifndef configUSE_TASK_NOTIFICATIONS
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef portMEMORY_BARRIER
+	#ifdef __GNUC__
+		/* A compiler barrier.  Sufficient on single core ports, where the only
+		concern is the compiler reordering memory accesses.  Ports for other
+		compilers must define their own portMEMORY_BARRIER() if they use code
+		that depends on it, such as mailbox.c. */
+		#define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
+	#endif
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
@@ -0,0 +1,287 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include arena.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * An arena hands out memory by advancing a pointer through one or more large
+ * chunks, and releases everything it handed out in one go when it is reset.
+ * Allocating from an arena takes a few instructions, and resetting an arena
+ * takes the same short time no matter how many allocations were made, so
+ * arenas suit work that makes many short lived allocations that can all be
+ * released together - for example the temporary buffers used while a single
+ * request is processed.  Memory cannot be returned to an arena individually.
+ *
+ * The first chunk is either allocated from the FreeRTOS heap, or provided by
+ * the application from a statically allocated buffer or memory region.  An
+ * arena created with xCanGrow set to pdTRUE allocates further chunks from the
+ * FreeRTOS heap when the current chunk is full.  Chunks are kept when the arena
+ * is reset, so once an arena has grown to the size its work needs it does not
+ * use the FreeRTOS heap again until it is deleted.
+ *
+ * An arena is not protected against concurrent access, which is what makes it
+ * fast.  Each arena must only be used by one task at a time - normally each
+ * task that needs one creates its own, and can store the handle in one of its
+ * thread local storage pointers so code it calls can find it.  Arenas must not
+ * be used from interrupts.
+ *
+ * \defgroup Arena
+ */
+
+/**
+ * arena.h
+ *
+ * Type by which arenas are referenced.  For example, a call to xArenaCreate()
+ * returns an ArenaHandle_t variable that can then be used as a parameter to
+ * other arena functions.
+ *
+ * \defgroup ArenaHandle_t ArenaHandle_t
+ * \ingroup Arena
+ */
+typedef void * ArenaHandle_t;
+
+/*
+ * Used with vArenaGetStats() to obtain the usage of an arena.
+ */
+typedef struct xARENA_STATS
+{
+	size_t xBytesInUse;					/*< The number of bytes handed out since the arena was last reset, including padding added for alignment. */
+	size_t xMaximumEverBytesInUse;		/*< The most bytes that have been in use since the arena was created. */
+	size_t xCapacity;					/*< The total size of the arena's chunks, excluding their headers. */
+	UBaseType_t uxChunkCount;			/*< The number of chunks, including the first. */
+	uint32_t ulAllocationFailures;		/*< The number of allocations that returned NULL. */
+} ArenaStats_t;
+
+/**
+ * arena.h
+ *<pre>
+ ArenaHandle_t xArenaCreate( size_t xChunkSize, BaseType_t xCanGrow );
+ </pre>
+ *
+ * Create a new arena.  The arena structure and its first chunk are allocated
+ * from the FreeRTOS heap in one allocation.
+ *
+ * @param xChunkSize The number of bytes that can be allocated from each chunk.
+ * An allocation larger than xChunkSize gets a chunk of its own.
+ *
+ * @param xCanGrow pdTRUE if further chunks can be allocated from the FreeRTOS
+ * heap when the current chunk is full, or pdFALSE if allocations should fail.
+ *
+ * @return If the arena was created then a handle to the arena is returned.  If
+ * there was insufficient FreeRTOS heap available to create the arena then NULL
+ * is returned.
+ *
+ * Example usage:
+   <pre>
+	void vRequestHandlerTask( void *pvParameters )
+	{
+	ArenaHandle_t xArena;
+	Request_t *pxRequest;
+	char *pcResponse;
+
+		// Create an arena large enough for a typical request.  Requests that
+		// need more cause the arena to grow.
+		xArena = xArenaCreate( 2048, pdTRUE );
+
+		for( ;; )
+		{
+			pxRequest = pxWaitForRequest();
+
+			// ... Any number of temporary allocations.
+			pcResponse = ( char * ) pvArenaAlloc( xArena, pxRequest->xResponseLength );
+
+			vSendResponse( pcResponse );
+
+			// Release everything allocated while processing the request.
+			vArenaReset( xArena );
+		}
+	}
+   </pre>
+ * \defgroup xArenaCreate xArenaCreate
+ * \ingroup Arena
+ */
+ArenaHandle_t xArenaCreate( size_t xChunkSize, BaseType_t xCanGrow ) PRIVILEGED_FUNCTION;
+
+/**
+ * arena.h
+ *<pre>
+ ArenaHandle_t xArenaCreateFromBuffer( void *pvBuffer, size_t xBufferSize, BaseType_t xCanGrow );
+ </pre>
+ *
+ * Create a new arena that uses memory provided by the application, rather
+ * than the FreeRTOS heap, for the arena structure and its first chunk.
+ *
+ * @param pvBuffer The start of the memory, which must remain valid until the
+ * arena is deleted.  It does not need to be aligned.
+ *
+ * @param xBufferSize The size of the memory in bytes.  Some of it is used to
+ * hold the arena structure.
+ *
+ * @param xCanGrow As for xArenaCreate().  Further chunks are allocated from
+ * the FreeRTOS heap, and are the size of the first chunk.
+ *
+ * @return A handle to the arena, or NULL if xBufferSize is too small to hold
+ * the arena structure.
+ *
+ * \defgroup xArenaCreateFromBuffer xArenaCreateFromBuffer
+ * \ingroup Arena
+ */
+ArenaHandle_t xArenaCreateFromBuffer( void *pvBuffer, size_t xBufferSize, BaseType_t xCanGrow ) PRIVILEGED_FUNCTION;
+
+/**
+ * arena.h
+ *<pre>
+ void *pvArenaAlloc( ArenaHandle_t xArena, size_t xSize );
+ </pre>
+ *
+ * Allocate xSize bytes from an arena, aligned to portBYTE_ALIGNMENT.
+ *
+ * @return A pointer to the memory, or NULL if the arena is full and either
+ * cannot grow or there was insufficient FreeRTOS heap available to grow it.
+ *
+ * \defgroup pvArenaAlloc pvArenaAlloc
+ * \ingroup Arena
+ */
+void *pvArenaAlloc( ArenaHandle_t xArena, size_t xSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * arena.h
+ *<pre>
+ void *pvArenaAllocAligned( ArenaHandle_t xArena, size_t xSize, size_t xAlignment );
+ </pre>
+ *
+ * Allocate xSize bytes from an arena, aligned to xAlignment bytes.
+ *
+ * @param xAlignment The alignment, which must be a power of two.  Alignments
+ * below portBYTE_ALIGNMENT can be used to pack small allocations together.
+ *
+ * \defgroup pvArenaAllocAligned pvArenaAllocAligned
+ * \ingroup Arena
+ */
+void *pvArenaAllocAligned( ArenaHandle_t xArena, size_t xSize, size_t xAlignment ) PRIVILEGED_FUNCTION;
+
+/**
+ * arena.h
+ *<pre>
+ void vArenaReset( ArenaHandle_t xArena );
+ </pre>
+ *
+ * Release everything that has been allocated from an arena.  The arena keeps
+ * its chunks, so no memory is returned to the FreeRTOS heap.  Pointers
+ * previously returned by the arena must not be used after it is reset.
+ *
+ * \defgroup vArenaReset vArenaReset
+ * \ingroup Arena
+ */
+void vArenaReset( ArenaHandle_t xArena ) PRIVILEGED_FUNCTION;
+
+/**
+ * arena.h
+ *<pre>
+ void vArenaGetStats( ArenaHandle_t xArena, ArenaStats_t *pxStats );
+ </pre>
+ *
+ * Obtain the usage, high water mark and size of an arena.
+ *
+ * \defgroup vArenaGetStats vArenaGetStats
+ * \ingroup Arena
+ */
+void vArenaGetStats( ArenaHandle_t xArena, ArenaStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * arena.h
+ *<pre>
+ void vArenaDelete( ArenaHandle_t xArena );
+ </pre>
+ *
+ * Delete an arena, returning the chunks that were allocated from the FreeRTOS
+ * heap to the heap.  The buffer passed to xArenaCreateFromBuffer() is not
+ * freed.
+ *
+ * \defgroup vArenaDelete vArenaDelete
+ * \ingroup Arena
+ */
+void vArenaDelete( ArenaHandle_t xArena ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H */
+
+
@@ -0,0 +1,217 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef BARRIER_H
+#define BARRIER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include barrier.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A barrier is a rendezvous point for a fixed number of tasks.  Each task that
+ * calls xBarrierWait() blocks until the number of tasks specified when the
+ * barrier was created have called xBarrierWait(), at which point all the tasks
+ * are released together and the barrier resets itself ready for the next
+ * round.
+ *
+ * xEventGroupSync() can be used for the same purpose, but requires one event
+ * bit per participating task and re-evaluates every waiting task each time a
+ * task arrives.  A barrier only counts arrivals, so the number of participants
+ * is not limited by the width of an event group, arriving is O(1), and only
+ * the last task to arrive walks the list of waiting tasks - once - to release
+ * them.  Each round is given a generation number so a task that times out can
+ * tell whether the round it arrived in completed before it was able to
+ * withdraw.
+ *
+ * Barriers cannot be used from interrupts.
+ *
+ * \defgroup Barrier
+ */
+
+/**
+ * barrier.h
+ *
+ * Type by which barriers are referenced.  For example, a call to
+ * xBarrierCreate() returns a BarrierHandle_t variable that can then be used as
+ * a parameter to other barrier functions.
+ *
+ * \defgroup BarrierHandle_t BarrierHandle_t
+ * \ingroup Barrier
+ */
+typedef void * BarrierHandle_t;
+
+/**
+ * barrier.h
+ *<pre>
+ BarrierHandle_t xBarrierCreate( UBaseType_t uxParticipants );
+ </pre>
+ *
+ * Create a new barrier.
+ *
+ * @param uxParticipants The number of tasks that must call xBarrierWait()
+ * before any of them are released.  Must be at least 1.
+ *
+ * @return If the barrier was created then a handle to the barrier is returned.
+ * If there was insufficient FreeRTOS heap available to create the barrier then
+ * NULL is returned.
+ *
+ * \defgroup xBarrierCreate xBarrierCreate
+ * \ingroup Barrier
+ */
+BarrierHandle_t xBarrierCreate( const UBaseType_t uxParticipants ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ *<pre>
+ BaseType_t xBarrierWait( BarrierHandle_t xBarrier, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Arrive at a barrier, then wait for the remaining participants to arrive.
+ *
+ * @param xBarrier The barrier being waited on.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for the remaining participants.  If the time expires before the remaining
+ * participants arrive then the calling task withdraws from the round, so the
+ * round still requires the full number of participants to complete.
+ *
+ * @return pdPASS if all the participants arrived, in which case the barrier
+ * has been reset for the next round.  pdFAIL if xTicksToWait expired first.
+ *
+ * Example usage:
+   <pre>
+	#define NUM_STAGES	3
+
+	BarrierHandle_t xStageBarrier;
+
+	void vCreateStages( void )
+	{
+		xStageBarrier = xBarrierCreate( NUM_STAGES );
+	}
+
+	void vStageTask( void *pvParameters )
+	{
+		for( ;; )
+		{
+			// Perform this stage's share of the work for this cycle.
+			vProcessStage( pvParameters );
+
+			// Wait for the other stages to finish their share before
+			// starting the next cycle.
+			if( xBarrierWait( xStageBarrier, pdMS_TO_TICKS( 10 ) ) != pdPASS )
+			{
+				// Another stage overran.
+			}
+		}
+	}
+   </pre>
+ * \defgroup xBarrierWait xBarrierWait
+ * \ingroup Barrier
+ */
+BaseType_t xBarrierWait( BarrierHandle_t xBarrier, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ *<pre>
+ UBaseType_t uxBarrierGetGeneration( BarrierHandle_t xBarrier );
+ </pre>
+ *
+ * @return The number of times the barrier has released its participants.
+ *
+ * \defgroup uxBarrierGetGeneration uxBarrierGetGeneration
+ * \ingroup Barrier
+ */
+UBaseType_t uxBarrierGetGeneration( BarrierHandle_t xBarrier ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ *<pre>
+ void vBarrierDelete( BarrierHandle_t xBarrier );
+ </pre>
+ *
+ * Delete a barrier that was created by a call to xBarrierCreate().  Tasks that
+ * are blocked on the barrier are released, and xBarrierWait() returns pdFAIL
+ * to them.
+ *
+ * \defgroup vBarrierDelete vBarrierDelete
+ * \ingroup Barrier
+ */
+void vBarrierDelete( BarrierHandle_t xBarrier ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BARRIER_H */
+
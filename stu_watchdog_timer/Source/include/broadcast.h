@@ -0,0 +1,365 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include broadcast.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A broadcast channel delivers every item that is published to it to every
+ * task that has subscribed to it.  Items are copied into a single ring buffer
+ * once, no matter how many subscribers there are, and each subscriber reads
+ * the buffer through its own read cursor.
+ *
+ * The publisher never blocks.  When the ring buffer is full the oldest item is
+ * overwritten.  A subscriber that falls so far behind that items it has not
+ * read are overwritten is not allowed to slow the publisher down - instead its
+ * next read returns the oldest item that is still available and reports how
+ * many items were lost.
+ *
+ * Subscribers that have read all the available items can block on the channel
+ * to wait for a new item to be published.
+ *
+ * \defgroup Broadcast
+ */
+
+/**
+ * broadcast.h
+ *
+ * Type by which broadcast channels are referenced.  For example, a call to
+ * xBroadcastCreate() returns a BroadcastHandle_t variable that can then be used
+ * as a parameter to other broadcast channel functions.
+ *
+ * \defgroup BroadcastHandle_t BroadcastHandle_t
+ * \ingroup Broadcast
+ */
+typedef void * BroadcastHandle_t;
+
+/**
+ * broadcast.h
+ *
+ * Type by which the subscribers of a broadcast channel are referenced.  A call
+ * to xBroadcastSubscribe() returns a BroadcastSubscriberHandle_t variable that
+ * is then used to read from the channel.
+ *
+ * \defgroup BroadcastSubscriberHandle_t BroadcastSubscriberHandle_t
+ * \ingroup Broadcast
+ */
+typedef void * BroadcastSubscriberHandle_t;
+
+/**
+ * broadcast.h
+ *<pre>
+ BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength, UBaseType_t uxItemSize );
+ </pre>
+ *
+ * Create a new broadcast channel.  This function cannot be called from an
+ * interrupt.
+ *
+ * @param uxLength The number of items the ring buffer can hold.  A subscriber
+ * can fall up to uxLength items behind the publisher before it starts to lose
+ * items.
+ *
+ * @param uxItemSize The size, in bytes, of each item published to the channel.
+ *
+ * @return If the channel was created then a handle to the channel is returned.
+ * If there was insufficient FreeRTOS heap available to create the channel then
+ * NULL is returned.
+ *
+ * \defgroup xBroadcastCreate xBroadcastCreate
+ * \ingroup Broadcast
+ */
+BroadcastHandle_t xBroadcastCreate( const UBaseType_t uxLength, const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ BroadcastSubscriberHandle_t xBroadcastSubscribe( BroadcastHandle_t xBroadcast );
+ </pre>
+ *
+ * Create a subscriber to a broadcast channel.  The subscriber will receive the
+ * items that are published after the call to xBroadcastSubscribe(), but not the
+ * items that were published before it.  This function cannot be called from an
+ * interrupt.
+ *
+ * Each subscriber is a read cursor into the channel, so a subscriber must only
+ * be read by one task at a time.
+ *
+ * @param xBroadcast The channel being subscribed to.
+ *
+ * @return If the subscriber was created then a handle to the subscriber is
+ * returned.  If there was insufficient FreeRTOS heap available to create the
+ * subscriber then NULL is returned.
+ *
+ * \defgroup xBroadcastSubscribe xBroadcastSubscribe
+ * \ingroup Broadcast
+ */
+BroadcastSubscriberHandle_t xBroadcastSubscribe( BroadcastHandle_t xBroadcast ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ void vBroadcastUnsubscribe( BroadcastSubscriberHandle_t xSubscriber );
+ </pre>
+ *
+ * Delete a subscriber that was created by a call to xBroadcastSubscribe().  The
+ * subscriber must not be in use by a task that is blocked on the channel.
+ *
+ * \defgroup vBroadcastUnsubscribe vBroadcastUnsubscribe
+ * \ingroup Broadcast
+ */
+void vBroadcastUnsubscribe( BroadcastSubscriberHandle_t xSubscriber ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ void vBroadcastPublish( BroadcastHandle_t xBroadcast, const void *pvItemToPublish );
+ </pre>
+ *
+ * Copy an item into the ring buffer of a broadcast channel, and unblock any
+ * subscribers that were waiting for a new item.  The item is copied once no
+ * matter how many subscribers the channel has.  The publisher never blocks - if
+ * the ring buffer is full the oldest item is overwritten.
+ *
+ * Subscribers that are not blocked cost nothing, but each subscriber that is
+ * blocked on the channel has to be unblocked, so the time taken grows with the
+ * number of blocked subscribers.  Each is unblocked in its own short critical
+ * section.
+ *
+ * This function must not be called from an interrupt.  See
+ * vBroadcastPublishFromISR() for an alternative that can be used in an ISR.
+ *
+ * @param xBroadcast The channel to which the item is being published.
+ *
+ * @param pvItemToPublish A pointer to the item being published.  The number of
+ * bytes copied is the item size specified when the channel was created.
+ *
+ * Example usage:
+   <pre>
+	typedef struct
+	{
+		uint32_t ulState;
+		TickType_t xTimestamp;
+	} WatchdogState_t;
+
+	BroadcastHandle_t xStateChannel;
+
+	void vSupervisorTask( void *pvParameters )
+	{
+	WatchdogState_t xState;
+
+		// Create a channel that allows monitors to fall up to 4 state changes
+		// behind before they start to lose them.
+		xStateChannel = xBroadcastCreate( 4, sizeof( WatchdogState_t ) );
+
+		for( ;; )
+		{
+			// ... Work out the new state, then tell every monitor about it.
+			vBroadcastPublish( xStateChannel, &xState );
+		}
+	}
+
+	void vMonitorTask( void *pvParameters )
+	{
+	BroadcastSubscriberHandle_t xSubscriber;
+	WatchdogState_t xState;
+	UBaseType_t uxLost;
+
+		xSubscriber = xBroadcastSubscribe( xStateChannel );
+
+		for( ;; )
+		{
+			// Wait up to 100ms for the next state change.
+			if( xBroadcastReceive( xSubscriber, &xState, &uxLost, pdMS_TO_TICKS( 100 ) ) == pdPASS )
+			{
+				if( uxLost != 0 )
+				{
+					// This monitor did not keep up, and missed uxLost state
+					// changes.
+				}
+
+				// ... Process xState here.
+			}
+		}
+	}
+   </pre>
+ * \defgroup vBroadcastPublish vBroadcastPublish
+ * \ingroup Broadcast
+ */
+void vBroadcastPublish( BroadcastHandle_t xBroadcast, const void * const pvItemToPublish ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ void vBroadcastPublishFromISR( BroadcastHandle_t xBroadcast, const void *pvItemToPublish, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of vBroadcastPublish() that can be called from an interrupt
+ * service routine.
+ *
+ * The item is copied with interrupts masked, then each subscriber that is
+ * blocked on the channel is unblocked with interrupts masked again, so
+ * higher priority interrupts are only ever held off for the time taken to copy
+ * one item or unblock one task.  The total time spent in the function still
+ * grows with the number of blocked subscribers, so an interrupt that publishes
+ * to a channel with many blocked subscribers should run at a low priority.
+ *
+ * @param xBroadcast The channel to which the item is being published.
+ *
+ * @param pvItemToPublish A pointer to the item being published.
+ *
+ * @param pxHigherPriorityTaskWoken vBroadcastPublishFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if publishing the item caused a
+ * subscriber to unblock, and the unblocked task has a priority higher than the
+ * currently running task.  If vBroadcastPublishFromISR() sets this value to
+ * pdTRUE then a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * \defgroup vBroadcastPublishFromISR vBroadcastPublishFromISR
+ * \ingroup Broadcast
+ */
+void vBroadcastPublishFromISR( BroadcastHandle_t xBroadcast, const void * const pvItemToPublish, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ BaseType_t xBroadcastReceive( BroadcastSubscriberHandle_t xSubscriber, void *pvBuffer, UBaseType_t *puxItemsLost, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Read the next item from a broadcast channel through a subscriber, optionally
+ * blocking to wait for an item to be published if the subscriber has already
+ * read all the items that are available.  Reading an item does not remove it
+ * from the channel, so reading through one subscriber has no effect on any
+ * other subscriber.  This function cannot be called from an interrupt.
+ *
+ * @param xSubscriber The subscriber through which the channel is being read, as
+ * returned by xBroadcastSubscribe().
+ *
+ * @param pvBuffer Pointer to the buffer into which the item will be copied.
+ *
+ * @param puxItemsLost If the subscriber fell so far behind that items it had
+ * not read were overwritten then the oldest item that is still available is
+ * returned, and the number of items that were missed is written to
+ * *puxItemsLost.  Otherwise *puxItemsLost is set to 0.  puxItemsLost can be set
+ * to NULL if the number of lost items is not required.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for an item to be published if one is not already available.
+ *
+ * @return pdPASS if an item was copied into pvBuffer, otherwise pdFAIL.
+ *
+ * \defgroup xBroadcastReceive xBroadcastReceive
+ * \ingroup Broadcast
+ */
+BaseType_t xBroadcastReceive( BroadcastSubscriberHandle_t xSubscriber, void * const pvBuffer, UBaseType_t * const puxItemsLost, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ UBaseType_t uxBroadcastItemsWaiting( BroadcastSubscriberHandle_t xSubscriber );
+ </pre>
+ *
+ * Returns the number of items that can be read through the subscriber without
+ * blocking.  If the subscriber has been overrun the value returned is capped to
+ * the length of the channel.
+ *
+ * \defgroup uxBroadcastItemsWaiting uxBroadcastItemsWaiting
+ * \ingroup Broadcast
+ */
+UBaseType_t uxBroadcastItemsWaiting( BroadcastSubscriberHandle_t xSubscriber ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ *<pre>
+ void vBroadcastDelete( BroadcastHandle_t xBroadcast );
+ </pre>
+ *
+ * Delete a broadcast channel that was created by a call to xBroadcastCreate().
+ * All the subscribers of the channel must be deleted, using
+ * vBroadcastUnsubscribe(), before the channel is deleted.
+ *
+ * \defgroup vBroadcastDelete vBroadcastDelete
+ * \ingroup Broadcast
+ */
+void vBroadcastDelete( BroadcastHandle_t xBroadcast ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BROADCAST_H */
+
+
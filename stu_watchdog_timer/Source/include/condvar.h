@@ -0,0 +1,247 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef CONDVAR_H
+#define CONDVAR_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include condvar.h"
+#endif
+
+#include "semphr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A condition variable allows a task to wait for a condition over some shared
+ * state to become true, where the shared state is protected by a mutex.  The
+ * waiting task releases the mutex and blocks as a single atomic operation, so
+ * a change made to the state by another task cannot be missed.  The task that
+ * changes the state calls vCondVarSignal() or vCondVarBroadcast() to unblock
+ * one or all of the waiting tasks.
+ *
+ * A waiting task must hold the mutex again before it can inspect the shared
+ * state.  When a task is signalled while the mutex is still held (normally by
+ * the signalling task itself) it is therefore not unblocked immediately -
+ * which would only result in it running and then blocking again on the mutex
+ * - but is instead moved directly to the list of tasks waiting for the mutex.
+ * The mutex holder inherits its priority, and the task is unblocked when the
+ * mutex is given.
+ *
+ * Each condition variable is associated with one mutex when it is created.
+ * Recursive mutexes cannot be used.  Condition variables cannot be used from
+ * interrupts, and are only available when configUSE_MUTEXES is set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * \defgroup CondVar
+ */
+
+/**
+ * condvar.h
+ *
+ * Type by which condition variables are referenced.  For example, a call to
+ * xCondVarCreate() returns a CondVarHandle_t variable that can then be used as
+ * a parameter to other condition variable functions.
+ *
+ * \defgroup CondVarHandle_t CondVarHandle_t
+ * \ingroup CondVar
+ */
+typedef void * CondVarHandle_t;
+
+/**
+ * condvar.h
+ *<pre>
+ CondVarHandle_t xCondVarCreate( SemaphoreHandle_t xMutex );
+ </pre>
+ *
+ * Create a new condition variable.
+ *
+ * @param xMutex The mutex that protects the state the condition is evaluated
+ * over.  The mutex must have been created using xSemaphoreCreateMutex().
+ *
+ * @return If the condition variable was created then a handle to the condition
+ * variable is returned.  If there was insufficient FreeRTOS heap available to
+ * create the condition variable then NULL is returned.
+ *
+ * \defgroup xCondVarCreate xCondVarCreate
+ * \ingroup CondVar
+ */
+CondVarHandle_t xCondVarCreate( SemaphoreHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * condvar.h
+ *<pre>
+ BaseType_t xCondVarWait( CondVarHandle_t xCondVar, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Release the mutex associated with the condition variable and block until the
+ * condition variable is signalled, then take the mutex again.  The calling task
+ * must hold the mutex.  The mutex is always held again when the function
+ * returns, whatever the return value.
+ *
+ * As with any condition variable, the caller must re-evaluate the condition
+ * after the function returns as another task may have changed the shared state
+ * between the signal and the mutex being taken.
+ *
+ * @param xCondVar The condition variable being waited on.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for the condition variable to be signalled.  This does not include any time
+ * spent waiting to take the mutex again after being signalled.
+ *
+ * @return pdPASS if the condition variable was signalled, or pdFAIL if the block
+ * time expired first.
+ *
+ * Example usage:
+   <pre>
+	SemaphoreHandle_t xBufferMutex;
+	CondVarHandle_t xBufferNotEmpty;
+	UBaseType_t uxBufferedItems = 0;
+
+	void vConsumer( void *pvParameters )
+	{
+		for( ;; )
+		{
+			xSemaphoreTake( xBufferMutex, portMAX_DELAY );
+
+			while( uxBufferedItems == 0 )
+			{
+				// Atomically releases xBufferMutex while waiting.
+				xCondVarWait( xBufferNotEmpty, portMAX_DELAY );
+			}
+
+			uxBufferedItems--;
+			xSemaphoreGive( xBufferMutex );
+		}
+	}
+
+	void vProducer( void )
+	{
+		xSemaphoreTake( xBufferMutex, portMAX_DELAY );
+		uxBufferedItems++;
+		vCondVarSignal( xBufferNotEmpty );
+		xSemaphoreGive( xBufferMutex );
+	}
+   </pre>
+ * \defgroup xCondVarWait xCondVarWait
+ * \ingroup CondVar
+ */
+BaseType_t xCondVarWait( CondVarHandle_t xCondVar, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * condvar.h
+ *<pre>
+ void vCondVarSignal( CondVarHandle_t xCondVar );
+ </pre>
+ *
+ * Signal the highest priority task that is waiting on the condition variable.
+ * The calling task does not need to hold the mutex, but normally will.  Has no
+ * effect if no tasks are waiting.
+ *
+ * \defgroup vCondVarSignal vCondVarSignal
+ * \ingroup CondVar
+ */
+void vCondVarSignal( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/**
+ * condvar.h
+ *<pre>
+ void vCondVarBroadcast( CondVarHandle_t xCondVar );
+ </pre>
+ *
+ * Signal every task that is waiting on the condition variable.  The tasks take
+ * the mutex again in priority order.
+ *
+ * \defgroup vCondVarBroadcast vCondVarBroadcast
+ * \ingroup CondVar
+ */
+void vCondVarBroadcast( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/**
+ * condvar.h
+ *<pre>
+ void vCondVarDelete( CondVarHandle_t xCondVar );
+ </pre>
+ *
+ * Delete a condition variable that was created by a call to xCondVarCreate().
+ * No tasks can be waiting on the condition variable.  The mutex is not deleted.
+ *
+ * \defgroup vCondVarDelete vCondVarDelete
+ * \ingroup CondVar
+ */
+void vCondVarDelete( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONDVAR_H */
+
@@ -215,7 +215,11 @@ EventGroupHandle_t xEventGroupCreate( void ) PRIVILEGED_FUNCTION;
  *
  * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
  * for one/all (depending on the xWaitForAllBits value) of the bits specified by
- * uxBitsToWaitFor to become set.
+ * uxBitsToWaitFor to become set.  If configUSE_EVENT_GROUP_DIRECT_ISR is 1 and
+ * configEVENT_GROUP_MAX_WAITERS tasks are already blocked on the event group
+ * the function does not block, but returns immediately as if the block time
+ * had expired, and traceEVENT_GROUP_WAIT_LIST_FULL() is called.  In that case
+ * xTicksToWait must not be portMAX_DELAY, which is caught by configASSERT().
  *
  * @return The value of the event group at the time either the bits being waited
  * for became set, or the block time expired.  Test the return value to know
@@ -344,6 +348,10 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * timer task to have the clear operation performed in the context of the timer 
  * task.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h then the
+ * bits are instead cleared directly, with interrupts masked, and pdPASS is
+ * always returned.
+ *
  * @param xEventGroup The event group in which the bits are to be cleared.
  *
  * @param uxBitsToClear A bitwise value that indicates the bit or bits to clear.
@@ -379,7 +387,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear ) xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL )
@@ -475,6 +483,22 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h then the
+ * bits are instead set, and any tasks whose wait condition is met are
+ * unblocked, directly from the interrupt with interrupts masked.  The timer
+ * task is not involved, so the latency is the same as a direct to task
+ * notification.  To keep the time spent with interrupts masked bounded no
+ * more than configEVENT_GROUP_MAX_WAITERS tasks can be blocked on the event
+ * group at once - once that many are blocked xEventGroupWaitBits() and
+ * xEventGroupSync() return the current event bits immediately, as if their
+ * block time had expired, and call traceEVENT_GROUP_WAIT_LIST_FULL().  Size
+ * configEVENT_GROUP_MAX_WAITERS so that does not happen to a task that waits
+ * with a block time of portMAX_DELAY, as configASSERT() fails if it does.
+ * Task level event group operations use critical
+ * sections as well as the scheduler lock.  pdPASS is always returned, and
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if an unblocked task has a
+ * priority above that of the interrupted task.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -531,7 +555,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken ) xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken )
@@ -572,7 +596,11 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * uxBitsToWaitFor to 0x07.  Etc.
  *
  * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
- * for all of the bits specified by uxBitsToWaitFor to become set.
+ * for all of the bits specified by uxBitsToWaitFor to become set.  As with
+ * xEventGroupWaitBits(), if configUSE_EVENT_GROUP_DIRECT_ISR is 1 and
+ * configEVENT_GROUP_MAX_WAITERS tasks are already blocked on the event group
+ * the function returns immediately as if the block time had expired, and
+ * xTicksToWait must not be portMAX_DELAY.
  *
  * @return The value of the event group at the time either the bits being waited
  * for became set, or the block time expired.  Test the return value to know
@@ -0,0 +1,367 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef HRTIMER_H
+#define HRTIMER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include hrtimer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * High resolution timers are one-shot timers that are driven by a hardware
+ * compare channel rather than by the RTOS tick.  The port provides a free
+ * running 32-bit counter, typically clocked at several MHz, and a compare
+ * register that generates an interrupt when the counter reaches a programmed
+ * value.  The compare register is always programmed for the active timer with
+ * the nearest deadline, so any number of timers can be multiplexed onto a
+ * single hardware channel.
+ *
+ * Each timer executes its callback either directly from the compare interrupt,
+ * which gives the lowest jitter, or from the high resolution timer service
+ * task, which runs at configHRTIMER_TASK_PRIORITY and can use the full task
+ * level API.
+ *
+ * Deadlines are expressed in counts of the port's counter.  A deadline must be
+ * less than half the counter range ahead of the current count.  The
+ * hrtimerUS_TO_COUNTS() macro converts microseconds to counts.
+ *
+ * The counter must never be written or reset by the application, as that
+ * would move every deadline.  Application code that shares the counter, for
+ * example for busy wait delays, must measure time as the unsigned difference
+ * between two reads.  On PIC32 ports the counter is the CP0 core timer Count
+ * register, so _CP0_SET_COUNT() must not be used, and the core timer interrupt
+ * is used by the high resolution timers.
+ *
+ * configUSE_HRTIMERS must be set to 1 in FreeRTOSConfig.h, and the port must
+ * provide the portHRTIMER_ macros, for the high resolution timer API to be
+ * available.
+ *
+ * \defgroup HRTimer
+ */
+
+/**
+ * hrtimer.h
+ *
+ * Type by which high resolution timers are referenced.  For example, a call to
+ * xHRTimerCreate() returns a HRTimerHandle_t variable that can then be used to
+ * reference the timer in calls to other high resolution timer API functions.
+ *
+ * \defgroup HRTimerHandle_t HRTimerHandle_t
+ * \ingroup HRTimer
+ */
+typedef void * HRTimerHandle_t;
+
+/*
+ * Defines the prototype to which high resolution timer callback functions
+ * must conform.  pxHigherPriorityTaskWoken is only valid when the callback is
+ * executed from the compare interrupt, in which case it must be passed to any
+ * FromISR API functions the callback calls.  It is NULL when the callback is
+ * executed from the high resolution timer service task.
+ */
+typedef void (*HRTimerCallbackFunction_t)( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*
+ * Used with vHRTimerGetStats() to obtain the latency between timer deadlines
+ * and the start of the corresponding callbacks.  All latencies are in counts.
+ */
+typedef struct xHRTIMER_STATS
+{
+	uint32_t ulExpiries;			/*< The number of callbacks that have been executed. */
+	uint32_t ulLastLatency;			/*< The latency of the most recent callback. */
+	uint32_t ulMaxLatency;			/*< The greatest latency of any callback. */
+	uint32_t ulTotalLatency;		/*< The sum of all latencies, for calculating the mean.  Wraps on overflow. */
+} HRTimerStats_t;
+
+/* Values that can be passed into the uxCallFromTask parameter of
+xHRTimerCreate(). */
+#define hrtimerCALL_FROM_ISR		( ( UBaseType_t ) 0U )
+#define hrtimerCALL_FROM_TASK		( ( UBaseType_t ) 1U )
+
+/* Converts a time in microseconds to counts of the high resolution counter. */
+#define hrtimerUS_TO_COUNTS( ulTimeInUs ) ( ( uint32_t ) ( ulTimeInUs ) * ( uint32_t ) portHRTIMER_COUNTS_PER_US )
+
+/**
+ * hrtimer.h
+ *<pre>
+ BaseType_t xHRTimerServiceStart( void );
+ </pre>
+ *
+ * Create the high resolution timer service task and configure the hardware
+ * compare channel.  Must be called once, before any high resolution timer is
+ * started.  Normally called from main() before the scheduler is started.
+ *
+ * @return pdPASS if the service task was created, otherwise pdFAIL.
+ *
+ * \defgroup xHRTimerServiceStart xHRTimerServiceStart
+ * \ingroup HRTimer
+ */
+BaseType_t xHRTimerServiceStart( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ HRTimerHandle_t xHRTimerCreate( const char * const pcTimerName, HRTimerCallbackFunction_t pxCallbackFunction, void * const pvTimerID, const UBaseType_t uxCallFromTask );
+ </pre>
+ *
+ * Create a new high resolution timer.  The timer is created in the dormant
+ * state and does not run until it is started.  This function cannot be called
+ * from an interrupt.
+ *
+ * @param pcTimerName A text name that is assigned to the timer.  It is not
+ * used by the kernel.
+ *
+ * @param pxCallbackFunction The function to call when the timer expires.
+ *
+ * @param pvTimerID An identifier that is assigned to the timer, which can be
+ * obtained with pvHRTimerGetTimerID().
+ *
+ * @param uxCallFromTask Set to hrtimerCALL_FROM_ISR to execute the callback
+ * directly from the compare interrupt, or to hrtimerCALL_FROM_TASK to execute
+ * the callback from the high resolution timer service task.
+ *
+ * @return A handle to the timer if it was created, otherwise NULL.
+ *
+ * Example usage:
+   <pre>
+	// Toggles an output exactly 250us after an input edge is detected.
+	static HRTimerHandle_t xPulseTimer;
+
+	static void prvPulseCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+		vToggleOutput();
+	}
+
+	void vSetup( void )
+	{
+		xPulseTimer = xHRTimerCreate( "Pulse", prvPulseCallback, NULL, hrtimerCALL_FROM_ISR );
+	}
+
+	void vEdgeInterruptHandler( void )
+	{
+		vHRTimerStartFromISR( xPulseTimer, 250 );
+	}
+   </pre>
+ * \defgroup xHRTimerCreate xHRTimerCreate
+ * \ingroup HRTimer
+ */
+HRTimerHandle_t xHRTimerCreate( const char * const pcTimerName, HRTimerCallbackFunction_t pxCallbackFunction, void * const pvTimerID, const UBaseType_t uxCallFromTask ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/**
+ * hrtimer.h
+ *<pre>
+ void vHRTimerStartAt( HRTimerHandle_t xTimer, uint32_t ulDeadline );
+ void vHRTimerStartAtFromISR( HRTimerHandle_t xTimer, uint32_t ulDeadline );
+ </pre>
+ *
+ * Start a timer so it expires when the high resolution counter reaches
+ * ulDeadline.  If the timer is already active it is restarted with the new
+ * deadline.  If the deadline has already passed the callback executes as soon
+ * as possible.
+ *
+ * Starting a timer from its own callback with a deadline calculated from its
+ * previous deadline generates a periodic event that does not accumulate drift.
+ *
+ * vHRTimerStartAt() must only be called from a task.  vHRTimerStartAtFromISR()
+ * must only be called from an interrupt, including a timer callback executed
+ * from the compare interrupt.
+ *
+ * \defgroup vHRTimerStartAt vHRTimerStartAt
+ * \ingroup HRTimer
+ */
+void vHRTimerStartAt( HRTimerHandle_t xTimer, const uint32_t ulDeadline ) PRIVILEGED_FUNCTION;
+void vHRTimerStartAtFromISR( HRTimerHandle_t xTimer, const uint32_t ulDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ void vHRTimerStart( HRTimerHandle_t xTimer, uint32_t ulDelayUs );
+ void vHRTimerStartFromISR( HRTimerHandle_t xTimer, uint32_t ulDelayUs );
+ </pre>
+ *
+ * Start a timer so it expires ulDelayUs microseconds from now.  Implemented as
+ * macros that call vHRTimerStartAt() and vHRTimerStartAtFromISR().
+ *
+ * \defgroup vHRTimerStart vHRTimerStart
+ * \ingroup HRTimer
+ */
+#define vHRTimerStart( xTimer, ulDelayUs ) vHRTimerStartAt( ( xTimer ), ulHRTimerGetCount() + hrtimerUS_TO_COUNTS( ulDelayUs ) )
+#define vHRTimerStartFromISR( xTimer, ulDelayUs ) vHRTimerStartAtFromISR( ( xTimer ), ulHRTimerGetCount() + hrtimerUS_TO_COUNTS( ulDelayUs ) )
+
+/**
+ * hrtimer.h
+ *<pre>
+ void vHRTimerStop( HRTimerHandle_t xTimer );
+ void vHRTimerStopFromISR( HRTimerHandle_t xTimer );
+ </pre>
+ *
+ * Stop a timer that is active.  Stopping a timer that has already expired has
+ * no effect, and a callback that is waiting to be executed by the service task
+ * is still executed.
+ *
+ * \defgroup vHRTimerStop vHRTimerStop
+ * \ingroup HRTimer
+ */
+void vHRTimerStop( HRTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+void vHRTimerStopFromISR( HRTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ void vHRTimerDelete( HRTimerHandle_t xTimer );
+ </pre>
+ *
+ * Stop a timer and free the memory it uses.  A callback that is waiting to be
+ * executed by the service task is discarded.  Must not be called from the
+ * timer's own callback, or while its callback is executing.
+ *
+ * \defgroup vHRTimerDelete vHRTimerDelete
+ * \ingroup HRTimer
+ */
+void vHRTimerDelete( HRTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ BaseType_t xHRTimerIsActive( HRTimerHandle_t xTimer );
+ </pre>
+ *
+ * @return pdTRUE if the timer has been started and has not yet expired or been
+ * stopped, otherwise pdFALSE.
+ *
+ * \defgroup xHRTimerIsActive xHRTimerIsActive
+ * \ingroup HRTimer
+ */
+BaseType_t xHRTimerIsActive( HRTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ void *pvHRTimerGetTimerID( HRTimerHandle_t xTimer );
+ </pre>
+ *
+ * @return The identifier that was assigned to the timer when it was created.
+ *
+ * \defgroup pvHRTimerGetTimerID pvHRTimerGetTimerID
+ * \ingroup HRTimer
+ */
+void *pvHRTimerGetTimerID( HRTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ uint32_t ulHRTimerGetCount( void );
+ </pre>
+ *
+ * @return The current value of the high resolution counter.  Can be called
+ * from a task or an interrupt.
+ *
+ * \defgroup ulHRTimerGetCount ulHRTimerGetCount
+ * \ingroup HRTimer
+ */
+uint32_t ulHRTimerGetCount( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * hrtimer.h
+ *<pre>
+ void vHRTimerGetStats( HRTimerStats_t *pxStats, BaseType_t xResetStats );
+ </pre>
+ *
+ * Obtain the callback latency statistics gathered across all high resolution
+ * timers.  Latency is measured from a timer's deadline to the start of its
+ * callback, so for callbacks executed from the service task it includes the
+ * time taken to schedule the task.
+ *
+ * @param pxStats The structure into which the statistics are written.
+ *
+ * @param xResetStats If pdTRUE the statistics are cleared after they have
+ * been read.
+ *
+ * \defgroup vHRTimerGetStats vHRTimerGetStats
+ * \ingroup HRTimer
+ */
+void vHRTimerGetStats( HRTimerStats_t *pxStats, const BaseType_t xResetStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the port layer from the compare interrupt.  Not part of the public
+ * API.
+ */
+void vHRTimerInterruptHandler( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HRTIMER_H */
+
+
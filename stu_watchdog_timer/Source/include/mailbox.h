@@ -0,0 +1,227 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include mailbox.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A mailbox holds the latest value of a piece of state that is written by one
+ * or more writers and read by any number of readers.  Each write replaces the
+ * value held in the mailbox, and readers always obtain the most recent value.
+ *
+ * Mailboxes provide the same function as a queue of length one written using
+ * xQueueOverwrite() and read using xQueuePeek(), but are implemented using a
+ * sequence lock.  Writers never block and only hold a critical section for the
+ * time it takes to copy the value.  Readers do not use a critical section at
+ * all - instead a reader copies the value out and then checks it was not
+ * written while the copy was taking place, retrying the copy if it was.
+ * Readers therefore never delay writers, interrupts, or each other.
+ *
+ * \defgroup Mailbox
+ */
+
+/**
+ * mailbox.h
+ *
+ * Type by which mailboxes are referenced.  For example, a call to
+ * xMailboxCreate() returns a MailboxHandle_t variable that can then be used as
+ * a parameter to other mailbox functions.
+ *
+ * \defgroup MailboxHandle_t MailboxHandle_t
+ * \ingroup Mailbox
+ */
+typedef void * MailboxHandle_t;
+
+/**
+ * mailbox.h
+ *<pre>
+ MailboxHandle_t xMailboxCreate( UBaseType_t uxItemSize );
+ </pre>
+ *
+ * Create a new mailbox.  The value held in the mailbox is initially all zeros.
+ * This function cannot be called from an interrupt.
+ *
+ * @param uxItemSize The size, in bytes, of the value held in the mailbox.
+ *
+ * @return If the mailbox was created then a handle to the mailbox is returned.
+ * If there was insufficient FreeRTOS heap available to create the mailbox then
+ * NULL is returned.
+ *
+ * \defgroup xMailboxCreate xMailboxCreate
+ * \ingroup Mailbox
+ */
+MailboxHandle_t xMailboxCreate( const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *<pre>
+ void vMailboxWrite( MailboxHandle_t xMailbox, const void *pvItemToWrite );
+ </pre>
+ *
+ * Replace the value held in a mailbox.  This function never blocks.  It must
+ * not be called from an interrupt - use vMailboxWriteFromISR() instead.
+ *
+ * @param xMailbox The mailbox being written.
+ *
+ * @param pvItemToWrite A pointer to the new value.  The number of bytes copied
+ * is the item size specified when the mailbox was created.
+ *
+ * \defgroup vMailboxWrite vMailboxWrite
+ * \ingroup Mailbox
+ */
+void vMailboxWrite( MailboxHandle_t xMailbox, const void * const pvItemToWrite ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *<pre>
+ void vMailboxWriteFromISR( MailboxHandle_t xMailbox, const void *pvItemToWrite );
+ </pre>
+ *
+ * A version of vMailboxWrite() that can be called from an interrupt service
+ * routine.  Tasks do not block on mailboxes, so writing a mailbox never causes
+ * a context switch.
+ *
+ * \defgroup vMailboxWriteFromISR vMailboxWriteFromISR
+ * \ingroup Mailbox
+ */
+void vMailboxWriteFromISR( MailboxHandle_t xMailbox, const void * const pvItemToWrite ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *<pre>
+ UBaseType_t uxMailboxRead( MailboxHandle_t xMailbox, void *pvBuffer );
+ </pre>
+ *
+ * Copy the value held in a mailbox into a buffer.  The copy is never torn - if
+ * a write occurs while the copy is in progress then the copy is repeated.
+ * This function does not use a critical section and can be called from both
+ * tasks and interrupts.
+ *
+ * @param xMailbox The mailbox being read.
+ *
+ * @param pvBuffer Pointer to the buffer into which the value is copied.
+ *
+ * @return The number of times the mailbox had been written when the value was
+ * read.  0 is returned if the mailbox has never been written, in which case the
+ * buffer will have been filled with zeros.  A reader that polls the mailbox can
+ * compare the returned value with the value returned by its previous call to
+ * know if the value has changed.
+ *
+ * Example usage:
+   <pre>
+	MailboxHandle_t xSetPoint;
+
+	void vControlLoop( void )
+	{
+	static UBaseType_t uxLastVersion = 0;
+	UBaseType_t uxVersion;
+	ControlSetPoint_t xNewSetPoint;
+
+		uxVersion = uxMailboxRead( xSetPoint, &xNewSetPoint );
+
+		if( uxVersion != uxLastVersion )
+		{
+			// The set point has been written since it was last read.
+			uxLastVersion = uxVersion;
+		}
+	}
+   </pre>
+ * \defgroup uxMailboxRead uxMailboxRead
+ * \ingroup Mailbox
+ */
+UBaseType_t uxMailboxRead( MailboxHandle_t xMailbox, void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *<pre>
+ void vMailboxDelete( MailboxHandle_t xMailbox );
+ </pre>
+ *
+ * Delete a mailbox that was created by a call to xMailboxCreate().
+ *
+ * \defgroup vMailboxDelete vMailboxDelete
+ * \ingroup Mailbox
+ */
+void vMailboxDelete( MailboxHandle_t xMailbox ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAILBOX_H */
+
+
@@ -0,0 +1,320 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef MEMPOOL_H
+#define MEMPOOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include mempool.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A memory pool provides a fixed number of memory blocks that are all the same
+ * size.  Allocating a block from a pool, and freeing a block back to a pool,
+ * takes the same short time no matter how many blocks are in use, does not
+ * suspend the scheduler, and can be performed from an interrupt.  When a pool
+ * is empty a task can block to wait for a block to be freed.
+ *
+ * Pools are a good way of passing messages that are too large to be copied
+ * into a queue.  The message is built in a block allocated from a pool, and a
+ * pointer to the block is sent to the queue.  The task that receives the
+ * pointer frees the block when it has finished with the message.
+ *
+ * \defgroup MemPool
+ */
+
+/**
+ * mempool.h
+ *
+ * Type by which memory pools are referenced.  For example, a call to
+ * xMemPoolCreate() returns a MemPoolHandle_t variable that can then be used as
+ * a parameter to other memory pool functions.
+ *
+ * \defgroup MemPoolHandle_t MemPoolHandle_t
+ * \ingroup MemPool
+ */
+typedef void * MemPoolHandle_t;
+
+/*
+ * Used with vMemPoolGetStats() to obtain the occupancy of a pool.
+ */
+typedef struct xMEMPOOL_STATS
+{
+	UBaseType_t uxBlockSize;				/*< The size of each block, after it has been rounded up to maintain alignment. */
+	UBaseType_t uxBlockCount;				/*< The number of blocks in the pool. */
+	UBaseType_t uxBlocksFree;				/*< The number of blocks that are currently free. */
+	UBaseType_t uxMinimumEverBlocksFree;	/*< The fewest blocks that have been free since the pool was created. */
+	uint32_t ulAllocationFailures;			/*< The number of allocations that returned NULL. */
+} MemPoolStats_t;
+
+/**
+ * mempool.h
+ *<pre>
+ MemPoolHandle_t xMemPoolCreate( UBaseType_t uxBlockSize, UBaseType_t uxBlockCount );
+ </pre>
+ *
+ * Create a new memory pool.  The pool structure and all its blocks are
+ * allocated from the FreeRTOS heap in one allocation.  This function cannot be
+ * called from an interrupt.
+ *
+ * @param uxBlockSize The size, in bytes, of each block.  The size is rounded up
+ * so every block is aligned to portBYTE_ALIGNMENT.
+ *
+ * @param uxBlockCount The number of blocks in the pool.
+ *
+ * @return If the pool was created then a handle to the pool is returned.  If
+ * there was insufficient FreeRTOS heap available to create the pool then NULL
+ * is returned.
+ *
+ * Example usage:
+   <pre>
+	typedef struct
+	{
+		uint8_t ucPayload[ 128 ];
+		size_t xLength;
+	} LargeMessage_t;
+
+	MemPoolHandle_t xMessagePool;
+	QueueHandle_t xMessageQueue;
+
+	void vSetup( void )
+	{
+		// Create enough blocks to hold one message for every slot in the
+		// queue, plus the one being processed.
+		xMessagePool = xMemPoolCreate( sizeof( LargeMessage_t ), 5 );
+		xMessageQueue = xQueueCreate( 4, sizeof( LargeMessage_t * ) );
+	}
+
+	void vProducerTask( void *pvParameters )
+	{
+	LargeMessage_t *pxMessage;
+
+		for( ;; )
+		{
+			// Wait up to 10ms for a block to be available.
+			pxMessage = ( LargeMessage_t * ) pvMemPoolAlloc( xMessagePool, pdMS_TO_TICKS( 10 ) );
+
+			if( pxMessage != NULL )
+			{
+				// ... Fill in the message, then send a pointer to it.  Only the
+				// pointer is copied into the queue.
+				xQueueSend( xMessageQueue, &pxMessage, portMAX_DELAY );
+			}
+		}
+	}
+
+	void vConsumerTask( void *pvParameters )
+	{
+	LargeMessage_t *pxMessage;
+
+		for( ;; )
+		{
+			xQueueReceive( xMessageQueue, &pxMessage, portMAX_DELAY );
+
+			// ... Process the message, then return the block to the pool.
+			vMemPoolFree( xMessagePool, pxMessage );
+		}
+	}
+   </pre>
+ * \defgroup xMemPoolCreate xMemPoolCreate
+ * \ingroup MemPool
+ */
+MemPoolHandle_t xMemPoolCreate( const UBaseType_t uxBlockSize, const UBaseType_t uxBlockCount ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ void *pvMemPoolAlloc( MemPoolHandle_t xMemPool, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Allocate a block from a memory pool, optionally blocking to wait for a block
+ * to be freed if the pool is empty.  This function must not be called from an
+ * interrupt - use pvMemPoolAllocFromISR() instead.
+ *
+ * @param xMemPool The pool from which the block is allocated.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for a block to become available if the pool is empty.
+ *
+ * @return A pointer to the allocated block, or NULL if no block was available
+ * before the block time expired.
+ *
+ * \defgroup pvMemPoolAlloc pvMemPoolAlloc
+ * \ingroup MemPool
+ */
+void *pvMemPoolAlloc( MemPoolHandle_t xMemPool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ void *pvMemPoolAllocFromISR( MemPoolHandle_t xMemPool );
+ </pre>
+ *
+ * A version of pvMemPoolAlloc() that can be called from an interrupt service
+ * routine.  The function does not block, so returns NULL immediately if the
+ * pool is empty.
+ *
+ * \defgroup pvMemPoolAllocFromISR pvMemPoolAllocFromISR
+ * \ingroup MemPool
+ */
+void *pvMemPoolAllocFromISR( MemPoolHandle_t xMemPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ void vMemPoolFree( MemPoolHandle_t xMemPool, void *pvBlock );
+ </pre>
+ *
+ * Return a block to the memory pool from which it was allocated.  If a task is
+ * blocked waiting for a block from the pool then the highest priority task
+ * that is waiting is unblocked.  This function must not be called from an
+ * interrupt - use vMemPoolFreeFromISR() instead.
+ *
+ * @param xMemPool The pool from which the block was allocated.
+ *
+ * @param pvBlock The block being freed.
+ *
+ * \defgroup vMemPoolFree vMemPoolFree
+ * \ingroup MemPool
+ */
+void vMemPoolFree( MemPoolHandle_t xMemPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ void vMemPoolFreeFromISR( MemPoolHandle_t xMemPool, void *pvBlock, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of vMemPoolFree() that can be called from an interrupt service
+ * routine.
+ *
+ * @param pxHigherPriorityTaskWoken vMemPoolFreeFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if freeing the block caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If vMemPoolFreeFromISR() sets this value to pdTRUE then a
+ * context switch should be requested before the interrupt is exited.
+ *
+ * \defgroup vMemPoolFreeFromISR vMemPoolFreeFromISR
+ * \ingroup MemPool
+ */
+void vMemPoolFreeFromISR( MemPoolHandle_t xMemPool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ UBaseType_t uxMemPoolGetBlocksFree( MemPoolHandle_t xMemPool );
+ </pre>
+ *
+ * Returns the number of blocks that are currently free.  Can be called from
+ * tasks and interrupts.
+ *
+ * \defgroup uxMemPoolGetBlocksFree uxMemPoolGetBlocksFree
+ * \ingroup MemPool
+ */
+UBaseType_t uxMemPoolGetBlocksFree( MemPoolHandle_t xMemPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ void vMemPoolGetStats( MemPoolHandle_t xMemPool, MemPoolStats_t *pxStats );
+ </pre>
+ *
+ * Obtain the size, occupancy and high water mark of a memory pool.
+ *
+ * \defgroup vMemPoolGetStats vMemPoolGetStats
+ * \ingroup MemPool
+ */
+void vMemPoolGetStats( MemPoolHandle_t xMemPool, MemPoolStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * mempool.h
+ *<pre>
+ void vMemPoolDelete( MemPoolHandle_t xMemPool );
+ </pre>
+ *
+ * Delete a memory pool that was created by a call to xMemPoolCreate().  No
+ * tasks can be blocked on the pool, and no blocks can be in use, when the pool
+ * is deleted.
+ *
+ * \defgroup vMemPoolDelete vMemPoolDelete
+ * \ingroup MemPool
+ */
+void vMemPoolDelete( MemPoolHandle_t xMemPool ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMPOOL_H */
+
+
@@ -149,8 +149,18 @@ typedef struct HeapRegion
 {
 	uint8_t *pucStartAddress;
 	size_t xSizeInBytes;
+	UBaseType_t uxClass;	/*<< The class of memory in the region, such as portHEAP_CLASS_FAST.  Only used when configUSE_HEAP_REGION_CLASSES is 1.  An initialiser that only gives the start address and size leaves it 0, which is portHEAP_CLASS_BULK. */
 } HeapRegion_t;
 
+/* Classes of memory a heap region can be tagged with when
+configUSE_HEAP_REGION_CLASSES is 1.  An application can use further classes,
+up to configHEAP_REGION_CLASS_COUNT - 1.  portHEAP_CLASS_BULK, the general
+purpose class that pvPortMalloc() prefers by default, is 0 so regions defined
+without a class are of that class. */
+#define portHEAP_CLASS_BULK		( ( UBaseType_t ) 0 )
+#define portHEAP_CLASS_FAST		( ( UBaseType_t ) 1 )
+#define portHEAP_CLASS_DMA		( ( UBaseType_t ) 2 )
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -164,6 +174,170 @@ typedef struct HeapRegion
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+/* Used by heap_5.c to pass the usage of one heap region out of
+xPortGetHeapRegionStats() when configUSE_HEAP_REGION_CLASSES is 1.  Sizes
+include the heap's own block headers. */
+typedef struct xHEAP_REGION_STATS
+{
+	uint8_t *pucStartAddress;			/*<< The start of the region, after alignment. */
+	size_t xSizeInBytes;				/*<< The space in the region available to the heap. */
+	UBaseType_t uxClass;				/*<< The class the region was tagged with. */
+	size_t xFreeBytes;					/*<< The sum of the free blocks in the region. */
+	size_t xMinimumEverFreeBytes;		/*<< The lowest value xFreeBytes has reached. */
+	size_t xAllocatedBlocks;			/*<< The number of blocks currently allocated from the region. */
+	uint32_t ulFallbackAllocations;		/*<< The number of requests for another class of memory that were served from the region because their own class was exhausted. */
+} HeapRegionStats_t;
+
+/*
+ * Only available when heap_5.c is used and configUSE_HEAP_REGION_CLASSES is 1.
+ *
+ * pvPortMallocFromClass() allocates from the regions tagged with uxClass.  If
+ * none of them has a large enough free block, and xFallBack is pdTRUE, the
+ * request is served from any region that does, otherwise NULL is returned.
+ * pvPortMalloc() prefers configHEAP_DEFAULT_REGION_CLASS, and the kernel
+ * allocates task control blocks and stacks with pvPortMallocTCB() and
+ * pvPortMallocStack(), which prefer configHEAP_KERNEL_REGION_CLASS.  Blocks
+ * from any class are freed with vPortFree().  The configUSE_HEAP_SLABS size
+ * classes are carved from configHEAP_DEFAULT_REGION_CLASS memory, so only serve
+ * requests for that class - task control blocks and stacks allocated from
+ * configHEAP_KERNEL_REGION_CLASS bypass them.
+ *
+ * xPortGetHeapRegionStats() fills *pxStats with the usage of the uxRegion'th
+ * region passed to vPortDefineHeapRegions() and returns pdPASS, or returns
+ * pdFAIL if there is no such region.
+ */
+void *pvPortMallocFromClass( size_t xWantedSize, UBaseType_t uxClass, BaseType_t xFallBack ) PRIVILEGED_FUNCTION;
+BaseType_t xPortGetHeapRegionStats( UBaseType_t uxRegion, HeapRegionStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/* Used by heap_4.c and heap_5.c to report on one of the size classes that
+serve small requests when configUSE_HEAP_SLABS is 1. */
+typedef struct xHEAP_SLAB_STATS
+{
+	size_t xObjectSize;			/*<< The largest request served by the class. */
+	uint32_t ulHits;			/*<< The number of requests served from objects already cached by the class. */
+	uint32_t ulMisses;			/*<< The number of requests that found the class empty, so had to refill it from the list of free blocks. */
+	UBaseType_t uxObjectsInUse;	/*<< The number of objects from the class that are currently allocated. */
+	UBaseType_t uxObjectsFree;	/*<< The number of objects cached by the class ready for use. */
+	UBaseType_t uxISRObjectsFree;	/*<< The number of objects held for pvPortMallocFromISR(), which are counted in uxObjectsInUse.  Always 0 if configUSE_HEAP_ISR_CACHE is not 1. */
+	uint32_t ulISRMisses;		/*<< The number of interrupt requests that found the class's interrupt cache empty. */
+	uint32_t ulChunksReleased;	/*<< The number of chunks returned to the list of free blocks because none of their objects were in use. */
+} HeapSlabStats_t;
+
+/*
+ * Obtain the statistics of size class uxClass, which must be less than
+ * configHEAP_SLAB_CLASS_COUNT.  Only available when heap_4.c or heap_5.c is
+ * used and configUSE_HEAP_SLABS is 1.  A high proportion of hits means most
+ * small requests are not walking the list of free blocks.
+ *
+ * A class takes configHEAP_SLAB_REFILL_OBJECTS objects at a time from the
+ * heap as one chunk, and returns the chunk to the heap as soon as none of its
+ * objects are in use.  So at worst a class holds
+ * configHEAP_SLAB_REFILL_OBJECTS - 1 unused objects for each chunk that still
+ * has an object in use, and nothing once all its objects have been freed.
+ * Objects held for pvPortMallocFromISR() count as in use.
+ */
+void vPortGetHeapSlabStats( UBaseType_t uxClass, HeapSlabStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * Only available when heap_4.c or heap_5.c is used and configUSE_HEAP_ISR_CACHE
+ * is 1.  pvPortMallocFromISR() can be called from an interrupt that is allowed
+ * to use the FreeRTOS API.  It only serves requests that fit a
+ * configUSE_HEAP_SLABS size class, from objects each class holds for
+ * interrupts, so the interrupt is only masked while one object is taken from
+ * a list.  If the class's cache is empty an object of a larger class is used,
+ * and if they are all empty NULL is returned - the malloc failed hook is not
+ * called.  A class holds nothing until it is first requested from an
+ * interrupt, then is topped up to configHEAP_ISR_CACHE_OBJECTS objects by the
+ * next call to pvPortMalloc(), or by vPortRefillISRCaches(), which the idle
+ * task calls.  So the first request for a class from an interrupt fails
+ * unless the class is included in the configHEAP_ISR_CACHE_CLASSES mask, in
+ * which case it is filled by the first call to pvPortMalloc().
+ *
+ * Blocks from pvPortMallocFromISR() can be freed with vPortFreeFromISR() or
+ * vPortFree(), and go back to the interrupt cache.  They are not counted in
+ * the statistics returned by vPortGetHeapStats() or charged to a task.
+ */
+void *pvPortMallocFromISR( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+void vPortFreeFromISR( void *pv ) PRIVILEGED_FUNCTION;
+void vPortRefillISRCaches( void ) PRIVILEGED_FUNCTION;
+
+/* The number of buckets in the xLiveAllocations histogram of HeapStats_t. */
+#ifndef configHEAP_STATS_HISTOGRAM_BUCKETS
+	#define configHEAP_STATS_HISTOGRAM_BUCKETS 10
+#endif
+
+/* Used by heap_4.c and heap_5.c to pass heap statistics out of
+vPortGetHeapStats(). */
+typedef struct xHEAP_STATS
+{
+	size_t xAvailableHeapSpaceInBytes;		/*<< The total heap size currently available - this is the sum of all the free blocks, not the largest block that can be allocated. */
+	size_t xSizeOfLargestFreeBlockInBytes;	/*<< The size of the largest free block at the time vPortGetHeapStats() is called. */
+	size_t xSizeOfSmallestFreeBlockInBytes;	/*<< The size of the smallest free block at the time vPortGetHeapStats() is called. */
+	size_t xNumberOfFreeBlocks;				/*<< The number of free blocks at the time vPortGetHeapStats() is called. */
+	size_t xMinimumEverFreeBytesRemaining;	/*<< The minimum amount of total free memory (sum of all free blocks) there has been in the heap since the system booted. */
+	size_t xNumberOfSuccessfulAllocations;	/*<< The number of calls to pvPortMalloc() that have returned a valid memory block. */
+	size_t xNumberOfSuccessfulFrees;		/*<< The number of calls to vPortFree() that have successfully freed a block of memory. */
+	size_t xLiveAllocations[ configHEAP_STATS_HISTOGRAM_BUCKETS ];	/*<< The number of allocated blocks by size, including the heap's own header.  Element n counts blocks of less than 2^( n + 5 ) bytes and, other than for n == 0, at least 2^( n + 4 ) bytes.  The last element also counts any larger blocks. */
+} HeapStats_t;
+
+/*
+ * Fill *pxHeapStats with the current heap statistics.  Only the largest and
+ * smallest free block sizes require the list of free blocks to be walked, the
+ * remaining values are maintained as blocks are allocated and freed.  A large
+ * amount of free space held in a large number of small blocks indicates a
+ * failed allocation was caused by fragmentation.  Objects cached by the
+ * configUSE_HEAP_SLABS size classes are not counted as free.  Only available
+ * when heap_4.c or heap_5.c is used.
+ */
+void vPortGetHeapStats( HeapStats_t *pxHeapStats ) PRIVILEGED_FUNCTION;
+
+/* Used by heap_4.c and heap_5.c to pass the heap usage of a task out of
+xPortGetTaskHeapUsage() when configUSE_HEAP_ACCOUNTING is 1.  Sizes include the
+heap's own block headers. */
+typedef struct xTASK_HEAP_USAGE
+{
+	size_t xLiveBytes;			/*<< The size of the blocks allocated by the task that have not yet been freed. */
+	size_t xPeakBytes;			/*<< The highest value xLiveBytes has reached. */
+	size_t xQuotaBytes;			/*<< The most the task is allowed to have allocated, or 0 if there is no limit. */
+	uint32_t ulQuotaFailures;	/*<< The number of requests refused because they would have taken the task over its quota. */
+} TaskHeapUsage_t;
+
+/*
+ * Only available when heap_4.c or heap_5.c is used and
+ * configUSE_HEAP_ACCOUNTING is 1.  Blocks are charged to the task that called
+ * pvPortMalloc(), or to no task if the scheduler has not been started, and are
+ * credited back to the same task whichever task frees them.
+ *
+ * vPortSetTaskHeapQuota() limits the amount the task pvTask, which is a
+ * TaskHandle_t or NULL for the calling task, can have allocated.  A request
+ * that would take the task's live bytes over xQuotaBytes fails, as if the heap
+ * were exhausted, and if configUSE_HEAP_QUOTA_HOOK is 1 the application
+ * provided vApplicationHeapQuotaHook( TaskHandle_t xTask, size_t xWantedSize )
+ * is called.  An xQuotaBytes of 0 removes the limit.  A request is checked
+ * against the largest block it could be given, including the header, padding
+ * and any remainder too small to split off, so it can be refused when it would
+ * have fitted by that margin.
+ *
+ * xPortGetTaskHeapUsage() fills *pxUsage with the usage of pvTask and returns
+ * pdPASS, or returns pdFAIL if nothing has been recorded for the task.
+ *
+ * vPortHeapTaskDeleted() is called by vTaskDelete().  Blocks the deleted task
+ * has not freed remain charged to it, but can no longer be queried.
+ */
+void vPortSetTaskHeapQuota( void *pvTask, size_t xQuotaBytes ) PRIVILEGED_FUNCTION;
+BaseType_t xPortGetTaskHeapUsage( void *pvTask, TaskHeapUsage_t *pxUsage ) PRIVILEGED_FUNCTION;
+void vPortHeapTaskDeleted( void *pvTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by heap_4.c and heap_5.c when configUSE_HEAP_CANARIES is 1.  Checks the
+ * next configHEAP_VERIFY_BLOCKS_PER_STEP blocks in the list of free blocks,
+ * continuing from where the previous call finished, and returns pdTRUE when
+ * the end of the list is reached.  Called from the idle task.  If a corrupted
+ * block is found, by this function or by vPortFree(), the application provided
+ * vApplicationHeapCorruptionHook( void *pvBlock ) is called.
+ */
+BaseType_t xPortHeapVerifyStep( void ) PRIVILEGED_FUNCTION;
+
 
 /*
  * Map to the memory management routines required for the port.
@@ -1535,6 +1535,52 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION
 	void vQueueUnregisterQueue( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * The statistics that are maintained for each queue, semaphore and mutex when
+ * configUSE_QUEUE_STATS is set to 1 in FreeRTOSConfig.h.
+ *
+ * The wait time histograms count the calls that entered the Blocked state by
+ * the total time, in ticks, for which they waited.  Bucket 0 counts waits of
+ * less than one tick, bucket n counts waits of between 2^(n-1) and (2^n)-1
+ * ticks, and the last bucket also counts all longer waits.  The number of
+ * buckets is set by configQUEUE_STATS_WAIT_BUCKETS.
+ */
+#if( configUSE_QUEUE_STATS == 1 )
+	typedef struct xQUEUE_STATS
+	{
+		UBaseType_t uxPeakMessagesWaiting;	/*< The most items the queue has held. */
+		uint32_t ulSendFailures;			/*< Sends (or gives) that returned without writing to the queue. */
+		uint32_t ulReceiveFailures;			/*< Receives, peeks (or takes) that returned without reading from the queue. */
+		uint32_t ulBlockedSends;			/*< Sends that entered the Blocked state because the queue was full. */
+		uint32_t ulBlockedReceives;			/*< Receives that entered the Blocked state because the queue was empty. */
+		uint32_t ulSendWaitHistogram[ configQUEUE_STATS_WAIT_BUCKETS ];		/*< Time blocked sends spent waiting. */
+		uint32_t ulReceiveWaitHistogram[ configQUEUE_STATS_WAIT_BUCKETS ];	/*< Time blocked receives spent waiting. */
+	} QueueStats_t;
+
+	/*
+	 * Copy the statistics of a queue, semaphore or mutex into *pxStats.
+	 */
+	void vQueueGetStats( QueueHandle_t xQueue, QueueStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Clear the statistics of a queue, semaphore or mutex.  The peak number of
+	 * items is reset to the number of items currently in the queue.
+	 */
+	void vQueueResetStats( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Obtain the statistics of the queue held in a slot of the queue registry,
+	 * so all the registered queues can be inspected by looping uxIndex from 0
+	 * to configQUEUE_REGISTRY_SIZE - 1.  If the slot is in use then the name
+	 * the queue was registered with is written to *ppcQueueName (if
+	 * ppcQueueName is not NULL), its statistics are written to *pxStats, and
+	 * pdPASS is returned.  Otherwise pdFAIL is returned.
+	 */
+	#if( configQUEUE_REGISTRY_SIZE > 0 )
+		BaseType_t xQueueGetRegistryStats( UBaseType_t uxIndex, const char **ppcQueueName, QueueStats_t *pxStats ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	#endif
+#endif /* configUSE_QUEUE_STATS */
+
 /*
  * Generic version of the queue creation function, which is in turn called by
  * any queue, semaphore or mutex creation function or macro.
@@ -1562,9 +1608,12 @@ QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseT
  * Note 2:  Blocking on a queue set that contains a mutex will not cause the
  * mutex holder to inherit the priority of the blocked task.
  *
- * Note 3:  An additional 4 bytes of RAM is required for each space in a every
- * queue added to a queue set.  Therefore counting semaphores that have a high
- * maximum count value should not be added to a queue set.
+ * Note 3:  A queue set holds at most one entry for each queue or semaphore
+ * added to it, irrespective of how many items the member holds.  An entry is
+ * posted to the set when a member becomes non-empty, and posted again when an
+ * item is read from a member that remains non-empty, so members that hold data
+ * are selected in turn and the RAM used by the set does not depend on the
+ * length of the members.
  *
  * Note 4:  A receive (in the case of a queue) or take (in the case of a
  * semaphore) operation must not be performed on a member of a queue set unless
@@ -1572,19 +1621,16 @@ QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseT
  *
  * @param uxEventQueueLength Queue sets store events that occur on
  * the queues and semaphores contained in the set.  uxEventQueueLength specifies
- * the maximum number of events that can be queued at once.  To be absolutely
- * certain that events are not lost uxEventQueueLength should be set to the
- * total sum of the length of the queues added to the set, where binary
- * semaphores and mutexes have a length of 1, and counting semaphores have a
- * length set by their maximum count value.  Examples:
+ * the maximum number of events that can be queued at once.  As the set holds
+ * at most one event per member uxEventQueueLength need only be set to the
+ * number of queues and semaphores that will be added to the set.  Examples:
  *  + If a queue set is to hold a queue of length 5, another queue of length 12,
- *    and a binary semaphore, then uxEventQueueLength should be set to
- *    (5 + 12 + 1), or 18.
- *  + If a queue set is to hold three binary semaphores then uxEventQueueLength
- *    should be set to (1 + 1 + 1 ), or 3.
+ *    and a binary semaphore, then uxEventQueueLength should be set to 3.
  *  + If a queue set is to hold a counting semaphore that has a maximum count of
  *    5, and a counting semaphore that has a maximum count of 3, then
- *    uxEventQueueLength should be set to (5 + 3), or 8.
+ *    uxEventQueueLength should be set to 2.
+ *  + Setting uxEventQueueLength to the total sum of the length of the members,
+ *    as was required by previous versions, remains valid but wastes RAM.
  *
  * @return If the queue set is created successfully then a handle to the created
  * queue set is returned.  Otherwise NULL is returned.
@@ -1654,6 +1700,10 @@ BaseType_t xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueS
  * Note 3:  A receive (in the case of a queue) or take (in the case of a
  * semaphore) operation must not be performed on a member of a queue set unless
  * a call to xQueueSelectFromSet() has first returned a handle to that set member.
+ * One item should be read from (or one take performed on) the returned member
+ * each time its handle is returned.  If the member still holds data after the
+ * read then its handle is placed back at the end of the set, so members that
+ * hold data are selected in turn.
  *
  * @param xQueueSet The queue set on which the task will (potentially) block.
  *
@@ -1682,6 +1732,16 @@ void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber ) PRI
 UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 uint8_t ucQueueGetQueueType( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Move the highest priority task from pxEventList to
+ * the list of tasks waiting to take xMutex, or unblock it if xMutex is not
+ * held.  Used by condition variables so a signalled task is not unblocked
+ * only to block again on the mutex.  Must be called from a critical section.
+ * Returns pdTRUE if a task was unblocked that has a priority above the calling
+ * task.
+ */
+BaseType_t xQueueMoveWaiterToMutex( List_t * const pxEventList, QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,254 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include rwlock.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A reader-writer lock protects data that is read often and written rarely.
+ * Any number of tasks can hold the lock for reading at the same time, but a
+ * task that holds the lock for writing holds it exclusively.
+ *
+ * Writers are given preference - once a writer is waiting for the lock, tasks
+ * that then try to take the lock for reading block until the writer has taken
+ * and released it.  When a writer releases the lock, all the tasks that are
+ * waiting to read are released together before the next writer is given the
+ * lock, so neither readers nor writers can be starved.
+ *
+ * A task that holds the lock for writing inherits the priority of higher
+ * priority tasks that block trying to take the lock, in the same way as a
+ * mutex holder.  Readers do not inherit priority as the lock does not record
+ * which tasks are reading.
+ *
+ * Taking the lock for reading when no writer holds or is waiting for the lock
+ * only requires a short critical section.  Reader-writer locks cannot be used
+ * from interrupts, and are only available when configUSE_MUTEXES is set to 1
+ * in FreeRTOSConfig.h.
+ *
+ * \defgroup RWLock
+ */
+
+/**
+ * rwlock.h
+ *
+ * Type by which reader-writer locks are referenced.  For example, a call to
+ * xRWLockCreate() returns an RWLockHandle_t variable that can then be used as
+ * a parameter to other reader-writer lock functions.
+ *
+ * \defgroup RWLockHandle_t RWLockHandle_t
+ * \ingroup RWLock
+ */
+typedef void * RWLockHandle_t;
+
+/**
+ * rwlock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreate( void );
+ </pre>
+ *
+ * Create a new reader-writer lock.  The lock is created unlocked.
+ *
+ * @return If the lock was created then a handle to the lock is returned.  If
+ * there was insufficient FreeRTOS heap available to create the lock then NULL
+ * is returned.
+ *
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLock
+ */
+RWLockHandle_t xRWLockCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Take a reader-writer lock for reading.  The lock must be released by calling
+ * vRWLockGiveRead() from the same task.
+ *
+ * @param xRWLock The lock being taken.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * if a writer holds, or is waiting for, the lock.
+ *
+ * @return pdPASS if the lock was taken, otherwise pdFAIL.
+ *
+ * Example usage:
+   <pre>
+	RWLockHandle_t xConfigLock;
+
+	uint32_t ulReadConfigValue( UBaseType_t uxIndex )
+	{
+	uint32_t ulValue = 0;
+
+		if( xRWLockTakeRead( xConfigLock, portMAX_DELAY ) == pdPASS )
+		{
+			// Any number of tasks can be in here at once, but never at the
+			// same time as vWriteConfigValue().
+			ulValue = ulConfigTable[ uxIndex ];
+			vRWLockGiveRead( xConfigLock );
+		}
+
+		return ulValue;
+	}
+
+	void vWriteConfigValue( UBaseType_t uxIndex, uint32_t ulValue )
+	{
+		if( xRWLockTakeWrite( xConfigLock, portMAX_DELAY ) == pdPASS )
+		{
+			ulConfigTable[ uxIndex ] = ulValue;
+			vRWLockGiveWrite( xConfigLock );
+		}
+	}
+   </pre>
+ * \defgroup xRWLockTakeRead xRWLockTakeRead
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *<pre>
+ void vRWLockGiveRead( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Release a reader-writer lock that was taken by calling xRWLockTakeRead().
+ * If this is the last reader and a writer is waiting then the writer is given
+ * the lock.
+ *
+ * \defgroup vRWLockGiveRead vRWLockGiveRead
+ * \ingroup RWLock
+ */
+void vRWLockGiveRead( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *<pre>
+ BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Take a reader-writer lock for writing.  The lock must be released by calling
+ * vRWLockGiveWrite() from the same task.  The lock is not recursive.
+ *
+ * @param xRWLock The lock being taken.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for the lock to be released by all the tasks that hold it.
+ *
+ * @return pdPASS if the lock was taken, otherwise pdFAIL.
+ *
+ * \defgroup xRWLockTakeWrite xRWLockTakeWrite
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *<pre>
+ void vRWLockGiveWrite( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Release a reader-writer lock that was taken by calling xRWLockTakeWrite().
+ * Any priority inherited while the lock was held is disinherited.  If tasks
+ * are waiting to read then they are all released, otherwise if a writer is
+ * waiting it is given the lock.
+ *
+ * \defgroup vRWLockGiveWrite vRWLockGiveWrite
+ * \ingroup RWLock
+ */
+void vRWLockGiveWrite( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *<pre>
+ void vRWLockDelete( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Delete a reader-writer lock that was created by a call to xRWLockCreate().
+ * The lock must not be held, and no tasks can be blocked on it.
+ *
+ * \defgroup vRWLockDelete vRWLockDelete
+ * \ingroup RWLock
+ */
+void vRWLockDelete( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RWLOCK_H */
+
@@ -1923,6 +1923,23 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, const TickType
 BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
 BaseType_t xTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS DISABLED.
+ *
+ * A version of xTaskRemoveFromUnorderedEventList() that does not require the
+ * scheduler to be suspended, so can be called from an interrupt.  If the
+ * scheduler is suspended the task is held on the pending ready list until the
+ * scheduler is resumed.  Used by event groups when
+ * configUSE_EVENT_GROUP_DIRECT_ISR is set to 1.
+ *
+ * @return pdTRUE if the task being removed has a higher priority than the task
+ * making the call, otherwise pdFALSE.
+ */
+BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -1973,6 +1990,23 @@ BaseType_t xTaskGetSchedulerState( void ) PRIVILEGED_FUNCTION;
  */
 void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
+/*
+ * As vTaskPriorityInherit(), but the mutex holder inherits the priority of
+ * pxWaitingTask rather than the priority of the calling task.  Used when a
+ * blocked task is moved onto the list of tasks waiting for a mutex.
+ */
+void vTaskPriorityInheritFromTask( TaskHandle_t const pxMutexHolder, TaskHandle_t const pxWaitingTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE CONDITION VARIABLE AND READER-WRITER LOCK MODULES.  vTaskSetSignalled()
+ * records that xTask was signalled, and must be called from a critical section.
+ * xTaskResetSignalled() returns pdTRUE if the calling task has been signalled
+ * since it last called xTaskResetSignalled(), and clears the record.
+ */
+void vTaskSetSignalled( TaskHandle_t const xTask ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskResetSignalled( void ) PRIVILEGED_FUNCTION;
+
 /*
  * Set the priority of a task back to its proper priority in the case that it
  * inherited a higher priority while it was holding a semaphore.
@@ -1130,6 +1130,88 @@ BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend, void *pvPar
  */
 const char * pcTimerGetTimerName( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/*
+ * The statistics that are maintained for each timer, and for all timers
+ * together, when configUSE_TIMER_STATS is set to 1 in FreeRTOSConfig.h.
+ *
+ * Lateness is the number of ticks between a timer's expiry time and the
+ * execution of its callback by the timer service task.  The lateness histogram
+ * counts callbacks by lateness.  Bucket 0 counts callbacks that executed on
+ * time, bucket n counts callbacks that executed between 2^(n-1) and (2^n)-1
+ * ticks late, and the last bucket also counts all later callbacks.  The number
+ * of buckets is set by configTIMER_STATS_LATENESS_BUCKETS.
+ */
+#if( configUSE_TIMER_STATS == 1 )
+	typedef struct xTIMER_STATS
+	{
+		uint32_t ulExpiries;			/*< The number of callbacks executed. */
+		uint32_t ulMissedPeriods;		/*< The number of whole periods by which auto-reload callbacks executed late. */
+		uint32_t ulSkippedPeriods;		/*< The number of auto-reload callbacks that were not executed because of the timer's catch-up policy. */
+		TickType_t xMaxLateness;		/*< The latest any callback executed. */
+		uint32_t ulLatenessHistogram[ configTIMER_STATS_LATENESS_BUCKETS ];
+	} TimerStats_t;
+
+	/*
+	 * Copy the statistics of a timer into *pxStats.  If xTimer is NULL the
+	 * statistics of all timers together are copied instead.
+	 */
+	void vTimerGetStats( TimerHandle_t xTimer, TimerStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Clear the statistics of a timer.  If xTimer is NULL the statistics of all
+	 * timers together, and the count returned by
+	 * ulTimerGetCommandQueueOverruns(), are cleared instead.
+	 */
+	void vTimerResetStats( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the number of times a timer command, or pended function call,
+	 * could not be sent because the timer queue was full.  A non-zero value
+	 * means configTIMER_QUEUE_LENGTH is too small, or the timer service task
+	 * is falling behind.
+	 */
+	uint32_t ulTimerGetCommandQueueOverruns( void ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TIMER_STATS */
+
+/*
+ * Catch-up policies, which determine how an auto-reload timer is reloaded when
+ * the timer service task has fallen one or more whole periods behind, for
+ * example because higher priority tasks starved it.  Available when
+ * configUSE_TIMER_CATCH_UP_POLICIES is set to 1 in FreeRTOSConfig.h.
+ *
+ * tmrCATCH_UP_ALL - the default, and the only behaviour without catch-up
+ * policies.  The timer is reloaded relative to its previous expiry time, so
+ * the callback executes once for every period, back to back, until the timer
+ * has caught up.
+ *
+ * tmrCATCH_UP_SKIP - the callback executes once, and the callbacks for the
+ * missed periods are skipped.  The next expiry is the first period boundary
+ * that is still in the future, so the timer keeps its original phase.
+ *
+ * tmrCATCH_UP_REPHASE - the callback executes once, and the next expiry is one
+ * whole period after the time the late callback was processed.
+ *
+ * Each skipped callback is counted in the ulSkippedPeriods statistic, if
+ * configUSE_TIMER_STATS is 1, and reported to the traceTIMER_PERIODS_SKIPPED()
+ * hook.
+ */
+#if( configUSE_TIMER_CATCH_UP_POLICIES == 1 )
+	#define tmrCATCH_UP_ALL			( ( UBaseType_t ) 0U )
+	#define tmrCATCH_UP_SKIP		( ( UBaseType_t ) 1U )
+	#define tmrCATCH_UP_REPHASE		( ( UBaseType_t ) 2U )
+
+	/*
+	 * Set the catch-up policy of a timer to one of the tmrCATCH_UP_ values.
+	 * Timers are created with the tmrCATCH_UP_ALL policy.
+	 */
+	void vTimerSetCatchUpPolicy( TimerHandle_t xTimer, const UBaseType_t uxPolicy ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the catch-up policy of a timer.
+	 */
+	UBaseType_t uxTimerGetCatchUpPolicy( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TIMER_CATCH_UP_POLICIES */
+
 /*
  * Functions beyond this part are not part of the public API and are intended
  * for use by the kernel only.
@@ -0,0 +1,245 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mailbox.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Without a barrier the compiler is free to move the copy of the value outside
+of the two reads of the sequence number, so a torn value could be returned. */
+#ifndef portMEMORY_BARRIER
+	#error portMEMORY_BARRIER() must be defined in portmacro.h to use mailboxes.
+#endif
+
+/*
+ * Definition of a mailbox.  uxSequence is incremented before and after the
+ * value is written, so it is odd while a write is in progress and even
+ * otherwise.  A reader that reads the same even sequence number before and
+ * after copying the value knows the copy was not torn.
+ */
+typedef struct MailboxDefinition
+{
+	volatile UBaseType_t uxSequence;	/*< Twice the number of completed writes, plus one while a write is in progress. */
+	UBaseType_t uxItemSize;				/*< The size of the value held in the mailbox. */
+	int8_t *pcValue;					/*< Points to the storage area holding the value. */
+} Mailbox_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Write the value.  Must be called with interrupts masked, so writes from
+ * different tasks and interrupts are serialised.
+ */
+static void prvWriteValue( Mailbox_t * const pxMailbox, const void * const pvItemToWrite ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+MailboxHandle_t xMailboxCreate( const UBaseType_t uxItemSize )
+{
+Mailbox_t *pxMailbox;
+
+	configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+	/* Allocate the mailbox and the storage for its value in one block. */
+	pxMailbox = ( Mailbox_t * ) pvPortMalloc( sizeof( Mailbox_t ) + ( size_t ) uxItemSize );
+
+	if( pxMailbox != NULL )
+	{
+		pxMailbox->uxSequence = ( UBaseType_t ) 0U;
+		pxMailbox->uxItemSize = uxItemSize;
+		pxMailbox->pcValue = ( ( int8_t * ) pxMailbox ) + sizeof( Mailbox_t );
+		( void ) memset( ( void * ) pxMailbox->pcValue, 0x00, ( size_t ) uxItemSize );
+		traceMAILBOX_CREATE( pxMailbox );
+	}
+	else
+	{
+		traceMAILBOX_CREATE_FAILED();
+	}
+
+	return ( MailboxHandle_t ) pxMailbox;
+}
+/*-----------------------------------------------------------*/
+
+void vMailboxWrite( MailboxHandle_t xMailbox, const void * const pvItemToWrite )
+{
+Mailbox_t * const pxMailbox = ( Mailbox_t * ) xMailbox;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItemToWrite );
+
+	taskENTER_CRITICAL();
+	{
+		traceMAILBOX_WRITE( pxMailbox );
+		prvWriteValue( pxMailbox, pvItemToWrite );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vMailboxWriteFromISR( MailboxHandle_t xMailbox, const void * const pvItemToWrite )
+{
+Mailbox_t * const pxMailbox = ( Mailbox_t * ) xMailbox;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItemToWrite );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+	system call interrupt priority. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		traceMAILBOX_WRITE_FROM_ISR( pxMailbox );
+		prvWriteValue( pxMailbox, pvItemToWrite );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMailboxRead( MailboxHandle_t xMailbox, void * const pvBuffer )
+{
+Mailbox_t * const pxMailbox = ( Mailbox_t * ) xMailbox;
+UBaseType_t uxSequence;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvBuffer );
+
+	for( ;; )
+	{
+		uxSequence = pxMailbox->uxSequence;
+
+		if( ( uxSequence & ( UBaseType_t ) 1U ) == ( UBaseType_t ) 0U )
+		{
+			/* The barriers ensure the copy is made after the first read of
+			the sequence number and before the second. */
+			portMEMORY_BARRIER();
+			( void ) memcpy( pvBuffer, ( void * ) pxMailbox->pcValue, ( size_t ) pxMailbox->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			portMEMORY_BARRIER();
+
+			if( uxSequence == pxMailbox->uxSequence )
+			{
+				/* The value was not written during the copy. */
+				break;
+			}
+			else
+			{
+				/* The reader was preempted by a writer part way through the
+				copy, so the copy may be torn.  Try again. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* A write is in progress.  This can only be observed by a reader
+			that is not masked by the critical section used by the writer. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return uxSequence >> 1;
+}
+/*-----------------------------------------------------------*/
+
+void vMailboxDelete( MailboxHandle_t xMailbox )
+{
+	configASSERT( xMailbox );
+	traceMAILBOX_DELETE( xMailbox );
+	vPortFree( xMailbox );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteValue( Mailbox_t * const pxMailbox, const void * const pvItemToWrite )
+{
+	( pxMailbox->uxSequence )++;
+	portMEMORY_BARRIER();
+
+	( void ) memcpy( ( void * ) pxMailbox->pcValue, pvItemToWrite, ( size_t ) pxMailbox->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	portMEMORY_BARRIER();
+	( pxMailbox->uxSequence )++;
+}
+
+
@@ -0,0 +1,473 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mempool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Free blocks are linked together through their first bytes, so a block must
+be large enough to hold the link. */
+typedef struct MEMPOOL_FREE_BLOCK
+{
+	struct MEMPOOL_FREE_BLOCK *pxNextFreeBlock;
+} MemPoolFreeBlock_t;
+
+/*
+ * Definition of a memory pool.  The blocks follow the structure in the same
+ * allocation, starting at the first aligned address after the structure.
+ */
+typedef struct MemPoolDefinition
+{
+	MemPoolFreeBlock_t *pxFreeList;		/*< The first free block, or NULL if every block is in use. */
+	uint8_t *pucBlocks;					/*< The first block. */
+	UBaseType_t uxBlockSize;			/*< The size of each block, rounded up to maintain alignment. */
+	UBaseType_t uxBlockCount;			/*< The number of blocks in the pool. */
+	UBaseType_t uxBlocksFree;			/*< The number of blocks on the free list. */
+	UBaseType_t uxMinimumEverBlocksFree;	/*< The fewest blocks that have been on the free list. */
+	uint32_t ulAllocationFailures;		/*< The number of allocations that returned NULL. */
+	List_t xTasksWaitingForBlock;		/*< List of tasks that are blocked waiting for a block to be freed.  Stored in priority order. */
+} MemPool_t;
+
+/* The size of the pool structure rounded up so the first block is aligned. */
+#define mempoolSTRUCT_SIZE	( ( sizeof( MemPool_t ) + ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Remove the first block from the free list.  Must be called with interrupts
+ * masked.  Returns NULL if the pool is empty.
+ */
+static void *prvPopBlock( MemPool_t * const pxMemPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return a block to the free list and unblock the highest priority task that
+ * was waiting for a block, if any.  Must be called with interrupts masked.
+ * Returns pdTRUE if the unblocked task has a priority above the calling task.
+ */
+static BaseType_t prvPushBlock( MemPool_t * const pxMemPool, void * const pvBlock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+MemPoolHandle_t xMemPoolCreate( const UBaseType_t uxBlockSize, const UBaseType_t uxBlockCount )
+{
+MemPool_t *pxMemPool;
+UBaseType_t uxAlignedBlockSize, ux;
+MemPoolFreeBlock_t *pxBlock;
+
+	configASSERT( uxBlockSize > ( UBaseType_t ) 0 );
+	configASSERT( uxBlockCount > ( UBaseType_t ) 0 );
+
+	/* Each block must be able to hold the free list link, and each must start
+	on an aligned address. */
+	uxAlignedBlockSize = uxBlockSize;
+	if( uxAlignedBlockSize < ( UBaseType_t ) sizeof( MemPoolFreeBlock_t ) )
+	{
+		uxAlignedBlockSize = ( UBaseType_t ) sizeof( MemPoolFreeBlock_t );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ( uxAlignedBlockSize & ( UBaseType_t ) portBYTE_ALIGNMENT_MASK ) != 0x00 )
+	{
+		uxAlignedBlockSize += ( ( UBaseType_t ) portBYTE_ALIGNMENT - ( uxAlignedBlockSize & ( UBaseType_t ) portBYTE_ALIGNMENT_MASK ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxMemPool = ( MemPool_t * ) pvPortMalloc( mempoolSTRUCT_SIZE + ( ( size_t ) uxAlignedBlockSize * ( size_t ) uxBlockCount ) );
+
+	if( pxMemPool != NULL )
+	{
+		pxMemPool->pucBlocks = ( ( uint8_t * ) pxMemPool ) + mempoolSTRUCT_SIZE;
+		pxMemPool->uxBlockSize = uxAlignedBlockSize;
+		pxMemPool->uxBlockCount = uxBlockCount;
+		pxMemPool->uxBlocksFree = uxBlockCount;
+		pxMemPool->uxMinimumEverBlocksFree = uxBlockCount;
+		pxMemPool->ulAllocationFailures = 0UL;
+		vListInitialise( &( pxMemPool->xTasksWaitingForBlock ) );
+
+		/* Link every block onto the free list, in address order. */
+		pxMemPool->pxFreeList = NULL;
+		for( ux = uxBlockCount; ux > ( UBaseType_t ) 0; ux-- )
+		{
+			pxBlock = ( MemPoolFreeBlock_t * ) ( pxMemPool->pucBlocks + ( ( ux - ( UBaseType_t ) 1 ) * uxAlignedBlockSize ) ); /*lint !e826 The block is large enough to hold the link. */
+			pxBlock->pxNextFreeBlock = pxMemPool->pxFreeList;
+			pxMemPool->pxFreeList = pxBlock;
+		}
+
+		traceMEMPOOL_CREATE( pxMemPool );
+	}
+	else
+	{
+		traceMEMPOOL_CREATE_FAILED();
+	}
+
+	return ( MemPoolHandle_t ) pxMemPool;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMemPoolAlloc( MemPoolHandle_t xMemPool, TickType_t xTicksToWait )
+{
+MemPool_t * const pxMemPool = ( MemPool_t * ) xMemPool;
+void *pvReturn;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxMemPool );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* The free list is also accessed by interrupts, so is only accessed from
+	within a critical section.  That allows the task to be placed on the event
+	list and the yield requested atomically with the test for a free block -
+	the yield is held pending until the critical section is exited. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			pvReturn = prvPopBlock( pxMemPool );
+
+			if( pvReturn != NULL )
+			{
+				traceMEMPOOL_ALLOC( pxMemPool, pvReturn );
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The pool is empty and no block time was specified (or the
+				block time has expired). */
+				( pxMemPool->ulAllocationFailures )++;
+				traceMEMPOOL_ALLOC_FAILED( pxMemPool );
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					traceBLOCKING_ON_MEMPOOL_ALLOC( pxMemPool );
+					vTaskPlaceOnEventList( &( pxMemPool->xTasksWaitingForBlock ), xTicksToWait );
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					/* Timed out.  Go around the loop once more so the pool is
+					checked a final time with xTicksToWait now zero. */
+					xTicksToWait = ( TickType_t ) 0;
+				}
+
+				/* Loop back to test for a free block again. */
+				taskEXIT_CRITICAL();
+				continue;
+			}
+		}
+		taskEXIT_CRITICAL();
+		break;
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMemPoolAllocFromISR( MemPoolHandle_t xMemPool )
+{
+MemPool_t * const pxMemPool = ( MemPool_t * ) xMemPool;
+void *pvReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMemPool );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+	system call interrupt priority. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pvReturn = prvPopBlock( pxMemPool );
+
+		if( pvReturn != NULL )
+		{
+			traceMEMPOOL_ALLOC( pxMemPool, pvReturn );
+		}
+		else
+		{
+			( pxMemPool->ulAllocationFailures )++;
+			traceMEMPOOL_ALLOC_FAILED( pxMemPool );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vMemPoolFree( MemPoolHandle_t xMemPool, void *pvBlock )
+{
+MemPool_t * const pxMemPool = ( MemPool_t * ) xMemPool;
+
+	configASSERT( pxMemPool );
+
+	if( pvBlock != NULL )
+	{
+		taskENTER_CRITICAL();
+		{
+			traceMEMPOOL_FREE( pxMemPool, pvBlock );
+
+			if( prvPushBlock( pxMemPool, pvBlock ) != pdFALSE )
+			{
+				/* The yield will not be performed until the critical section
+				is exited. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vMemPoolFreeFromISR( MemPoolHandle_t xMemPool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+MemPool_t * const pxMemPool = ( MemPool_t * ) xMemPool;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMemPool );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+	system call interrupt priority. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	if( pvBlock != NULL )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			traceMEMPOOL_FREE( pxMemPool, pvBlock );
+
+			if( prvPushBlock( pxMemPool, pvBlock ) != pdFALSE )
+			{
+				if( pxHigherPriorityTaskWoken != NULL )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMemPoolGetBlocksFree( MemPoolHandle_t xMemPool )
+{
+	configASSERT( xMemPool );
+
+	/* A single aligned word is read, so no critical section is needed. */
+	return ( ( MemPool_t * ) xMemPool )->uxBlocksFree;
+}
+/*-----------------------------------------------------------*/
+
+void vMemPoolGetStats( MemPoolHandle_t xMemPool, MemPoolStats_t *pxStats )
+{
+MemPool_t * const pxMemPool = ( MemPool_t * ) xMemPool;
+
+	configASSERT( pxMemPool );
+	configASSERT( pxStats );
+
+	taskENTER_CRITICAL();
+	{
+		pxStats->uxBlockSize = pxMemPool->uxBlockSize;
+		pxStats->uxBlockCount = pxMemPool->uxBlockCount;
+		pxStats->uxBlocksFree = pxMemPool->uxBlocksFree;
+		pxStats->uxMinimumEverBlocksFree = pxMemPool->uxMinimumEverBlocksFree;
+		pxStats->ulAllocationFailures = pxMemPool->ulAllocationFailures;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vMemPoolDelete( MemPoolHandle_t xMemPool )
+{
+MemPool_t * const pxMemPool = ( MemPool_t * ) xMemPool;
+
+	configASSERT( pxMemPool );
+	configASSERT( listLIST_IS_EMPTY( &( pxMemPool->xTasksWaitingForBlock ) ) != pdFALSE );
+	configASSERT( pxMemPool->uxBlocksFree == pxMemPool->uxBlockCount );
+
+	traceMEMPOOL_DELETE( pxMemPool );
+	vPortFree( pxMemPool );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvPopBlock( MemPool_t * const pxMemPool )
+{
+MemPoolFreeBlock_t *pxBlock;
+
+	pxBlock = pxMemPool->pxFreeList;
+
+	if( pxBlock != NULL )
+	{
+		pxMemPool->pxFreeList = pxBlock->pxNextFreeBlock;
+		( pxMemPool->uxBlocksFree )--;
+
+		if( pxMemPool->uxBlocksFree < pxMemPool->uxMinimumEverBlocksFree )
+		{
+			pxMemPool->uxMinimumEverBlocksFree = pxMemPool->uxBlocksFree;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( void * ) pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPushBlock( MemPool_t * const pxMemPool, void * const pvBlock )
+{
+MemPoolFreeBlock_t * const pxBlock = ( MemPoolFreeBlock_t * ) pvBlock;
+BaseType_t xReturn = pdFALSE;
+
+	/* The block must be one that was allocated from this pool. */
+	configASSERT( ( ( uint8_t * ) pvBlock ) >= pxMemPool->pucBlocks );
+	configASSERT( ( ( uint8_t * ) pvBlock ) < ( pxMemPool->pucBlocks + ( pxMemPool->uxBlockSize * pxMemPool->uxBlockCount ) ) );
+	configASSERT( ( ( size_t ) ( ( ( uint8_t * ) pvBlock ) - pxMemPool->pucBlocks ) % ( size_t ) pxMemPool->uxBlockSize ) == ( size_t ) 0 );
+	configASSERT( pxMemPool->uxBlocksFree < pxMemPool->uxBlockCount );
+
+	pxBlock->pxNextFreeBlock = pxMemPool->pxFreeList;
+	pxMemPool->pxFreeList = pxBlock;
+	( pxMemPool->uxBlocksFree )++;
+
+	/* Only one block was freed, so only one task needs to be unblocked.  Event
+	lists are stored in priority order so the highest priority waiting task is
+	unblocked. */
+	if( listLIST_IS_EMPTY( &( pxMemPool->xTasksWaitingForBlock ) ) == pdFALSE )
+	{
+		xReturn = xTaskRemoveFromEventList( &( pxMemPool->xTasksWaitingForBlock ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+
+
@@ -174,6 +174,28 @@ extern void __attribute__( (interrupt(IPL1AUTO), vector( configTICK_INTERRUPT_VE
  */
 void __attribute__( (interrupt(IPL1AUTO), vector(_CORE_SOFTWARE_0_VECTOR))) vPortYieldISR( void );
 
+#if ( configUSE_HRTIMERS == 1 )
+
+	#if ( configTICK_INTERRUPT_VECTOR == _CORE_TIMER_VECTOR )
+		#error The high resolution timers use the core timer, so it cannot also generate the tick.
+	#endif
+
+	/* The core timer interrupt priority must not be above
+	configMAX_SYSCALL_INTERRUPT_PRIORITY as the interrupt uses the FreeRTOS
+	API. */
+	#ifndef configHRTIMER_INTERRUPT_PRIORITY
+		#define configHRTIMER_INTERRUPT_PRIORITY configMAX_SYSCALL_INTERRUPT_PRIORITY
+	#endif
+
+	/*
+	 * The core timer interrupt handler used by the high resolution timers.  As
+	 * with the tick interrupt the IPL setting has no effect.  The interrupt
+	 * priority is set in vPortHRTimerSetup().
+	 */
+	extern void __attribute__( (interrupt(IPL1AUTO), vector(_CORE_TIMER_VECTOR))) vPortHRTimerInterruptWrapper( void );
+
+#endif /* configUSE_HRTIMERS */
+
 /*
  * Used to catch tasks that attempt to return from their implementing function.
  */
@@ -273,6 +295,43 @@ const uint32_t ulCompareMatch = ( (configPERIPHERAL_CLOCK_HZ / portTIMER_PRESCAL
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_HRTIMERS == 1 )
+
+	void vPortHRTimerSetup( void )
+	{
+		IEC0CLR = _IEC0_CTIE_MASK;
+		IFS0CLR = _IFS0_CTIF_MASK;
+		IPC0CLR = _IPC0_CTIP_MASK;
+		IPC0SET = ( configHRTIMER_INTERRUPT_PRIORITY << _IPC0_CTIP_POSITION );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHRTimerSetCompare( uint32_t ulCompare )
+	{
+		/* Writing the compare register also clears the pending core timer
+		interrupt within the CPU. */
+		_CP0_SET_COMPARE( ulCompare );
+		IFS0CLR = _IFS0_CTIF_MASK;
+		IEC0SET = _IEC0_CTIE_MASK;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHRTimerDisableCompare( void )
+	{
+		IEC0CLR = _IEC0_CTIE_MASK;
+		IFS0CLR = _IFS0_CTIF_MASK;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHRTimerForceInterrupt( void )
+	{
+		IFS0SET = _IFS0_CTIF_MASK;
+		IEC0SET = _IEC0_CTIE_MASK;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_HRTIMERS */
+
 void vPortEndScheduler(void)
 {
 	/* Not implemented in ports where there is nothing to return to.
@@ -221,6 +221,25 @@ extern volatile UBaseType_t uxInterruptNesting;
 
 #define portNOP()	__asm volatile ( "nop" )
 
+/* Prevents the compiler moving memory accesses across the barrier. */
+#define portMEMORY_BARRIER() __asm volatile ( "" ::: "memory" )
+
+/* High resolution timer support.  The CP0 core timer counts at half the CPU
+clock, and its compare register generates the core timer interrupt.  When
+configUSE_HRTIMERS is 1 the application must not write the Count register, or
+use the core timer interrupt itself - see hrtimer.h. */
+void vPortHRTimerSetup( void );
+void vPortHRTimerSetCompare( uint32_t ulCompare );
+void vPortHRTimerDisableCompare( void );
+void vPortHRTimerForceInterrupt( void );
+#define portHRTIMER_GET_COUNT()				_CP0_GET_COUNT()
+#define portHRTIMER_COUNTS_PER_US			( configCPU_CLOCK_HZ / 2000000UL )
+#define portHRTIMER_MIN_COUNTS				( 2UL * portHRTIMER_COUNTS_PER_US )
+#define portHRTIMER_SETUP()					vPortHRTimerSetup()
+#define portHRTIMER_SET_COMPARE( ulCount )	vPortHRTimerSetCompare( ulCount )
+#define portHRTIMER_DISABLE_COMPARE()		vPortHRTimerDisableCompare()
+#define portHRTIMER_FORCE_INTERRUPT()		vPortHRTimerForceInterrupt()
+
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
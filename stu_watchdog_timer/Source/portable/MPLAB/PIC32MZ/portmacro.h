@@ -232,6 +232,9 @@ extern volatile UBaseType_t uxInterruptNesting;
 
 #define portNOP()	__asm volatile ( "nop" )
 
+/* Prevents the compiler moving memory accesses across the barrier. */
+#define portMEMORY_BARRIER() __asm volatile ( "" ::: "memory" )
+
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
@@ -88,6 +88,30 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* The kernel calls functions that only heap_4.c and heap_5.c provide when
+these options are set to 1, so they cannot be used with this heap. */
+#if( configUSE_HEAP_SLABS == 1 )
+	#error configUSE_HEAP_SLABS can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+	#error configUSE_HEAP_ACCOUNTING can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_CANARIES == 1 )
+	#error configUSE_HEAP_CANARIES can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+	#error configUSE_HEAP_ISR_CACHE can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+/* pvPortMallocTCB() and pvPortMallocStack() use pvPortMallocFromClass() when
+configUSE_HEAP_REGION_CLASSES is 1, and only heap_5.c provides it. */
+#if( configUSE_HEAP_REGION_CLASSES == 1 )
+	#error configUSE_HEAP_REGION_CLASSES can only be set to 1 when heap_5.c is used
+#endif
+
 /* A few bytes might be lost to byte aligning the heap start address. */
 #define configADJUSTED_HEAP_SIZE	( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT )
 
@@ -151,6 +175,7 @@ void *pvPortMalloc( size_t xWantedSize )
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 static BaseType_t xHeapHasBeenInitialised = pdFALSE;
 void *pvReturn = NULL;
+const size_t xRequestedSize = xWantedSize;
 
 	vTaskSuspendAll();
 	{
@@ -221,6 +246,11 @@ void *pvReturn = NULL;
 		}
 
 		traceMALLOC( pvReturn, xWantedSize );
+		traceMALLOC_REQUESTED( pvReturn, xRequestedSize );
+
+		/* Prevent compiler warnings when traceMALLOC_REQUESTED() is not
+		defined. */
+		( void ) xRequestedSize;
 	}
 	( void ) xTaskResumeAll();
 
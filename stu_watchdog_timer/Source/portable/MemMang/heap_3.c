@@ -91,6 +91,30 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* The kernel calls functions that only heap_4.c and heap_5.c provide when
+these options are set to 1, so they cannot be used with this heap. */
+#if( configUSE_HEAP_SLABS == 1 )
+	#error configUSE_HEAP_SLABS can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+	#error configUSE_HEAP_ACCOUNTING can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_CANARIES == 1 )
+	#error configUSE_HEAP_CANARIES can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+	#error configUSE_HEAP_ISR_CACHE can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+/* pvPortMallocTCB() and pvPortMallocStack() use pvPortMallocFromClass() when
+configUSE_HEAP_REGION_CLASSES is 1, and only heap_5.c provides it. */
+#if( configUSE_HEAP_REGION_CLASSES == 1 )
+	#error configUSE_HEAP_REGION_CLASSES can only be set to 1 when heap_5.c is used
+#endif
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
@@ -101,6 +125,7 @@ void *pvReturn;
 	{
 		pvReturn = malloc( xWantedSize );
 		traceMALLOC( pvReturn, xWantedSize );
+		traceMALLOC_REQUESTED( pvReturn, xWantedSize );
 	}
 	( void ) xTaskResumeAll();
 
@@ -87,6 +87,12 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* pvPortMallocTCB() and pvPortMallocStack() use pvPortMallocFromClass() when
+configUSE_HEAP_REGION_CLASSES is 1, and only heap_5.c provides it. */
+#if( configUSE_HEAP_REGION_CLASSES == 1 )
+	#error configUSE_HEAP_REGION_CLASSES can only be set to 1 when heap_5.c is used
+#endif
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -108,8 +114,29 @@ typedef struct A_BLOCK_LINK
 {
 	struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block in the list. */
 	size_t xBlockSize;						/*<< The size of the free block. */
+	#if( configUSE_HEAP_ACCOUNTING == 1 )
+		UBaseType_t uxAccount;				/*<< While the block is allocated, one more than the index of the account it is charged to, or 0 if it is not charged to an account. */
+	#endif
+	#if( configUSE_HEAP_CANARIES == 1 )
+		size_t xCanary;						/*<< heapHEADER_CANARY() of the block, so corruption of the header can be detected. */
+	#endif
 } BlockLink_t;
 
+#if( configUSE_HEAP_CANARIES == 1 )
+
+	/* The value held in the xCanary member of a block header depends on the
+	block's size, so a corrupted size is also detected.  The last size_t of
+	an allocated block holds a trailer canary that depends on the block's
+	address. */
+	#define heapCANARY_PATTERN				( ( size_t ) 0x5a5aa5a5UL )
+	#define heapHEADER_CANARY( pxLink )		( heapCANARY_PATTERN ^ ( pxLink )->xBlockSize )
+	#define heapTRAILER_CANARY( pxLink )	( heapCANARY_PATTERN ^ ( size_t ) ( pxLink ) )
+
+	/* The space added to each block for the trailer canary. */
+	#define heapTRAILER_SIZE				( sizeof( size_t ) )
+
+#endif /* configUSE_HEAP_CANARIES */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -120,6 +147,119 @@ typedef struct A_BLOCK_LINK
  */
 static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
 
+/*
+ * Take a block of at least xWantedSize bytes, plus its BlockLink_t header,
+ * from the list of free blocks.  Returns a pointer to the memory after the
+ * header, or NULL if no free block is large enough.  Must be called with the
+ * scheduler suspended.
+ */
+static void *prvAllocateBlock( size_t xWantedSize );
+
+/*
+ * Update the allocation or free count, and the histogram of live
+ * allocations, as the block pxLink is allocated (xAllocated is pdTRUE) or
+ * freed (xAllocated is pdFALSE).
+ */
+static void prvUpdateAllocationStats( const BlockLink_t *pxLink, BaseType_t xAllocated );
+
+/*
+ * Return the size of the allocated block pxLink, including its header.
+ */
+static size_t prvGetAllocatedBlockSize( const BlockLink_t *pxLink );
+
+#if( configUSE_HEAP_CANARIES == 1 )
+
+	/*
+	 * Write the header canary of the block pxLink and, if the block is
+	 * allocated, its trailer canary.
+	 */
+	static void prvSetCanaries( BlockLink_t *pxLink );
+
+	/*
+	 * Return pdFALSE if the header canary of the block pxLink or, if
+	 * xCheckTrailer is pdTRUE, the trailer canary of the allocated block pxLink
+	 * has been overwritten.
+	 */
+	static BaseType_t prvAreCanariesIntact( const BlockLink_t *pxLink, BaseType_t xCheckTrailer );
+
+#endif /* configUSE_HEAP_CANARIES */
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	/*
+	 * Return one more than the index of the account of task xTask, or 0 if the
+	 * task has no account.  If xCreate is pdTRUE an account is created for a
+	 * task that does not have one, if there is an unused account.
+	 */
+	static UBaseType_t prvFindAccount( TaskHandle_t xTask, BaseType_t xCreate );
+
+	/*
+	 * Return pdFALSE if charging a block of xBlockSize bytes would take the
+	 * account uxAccount over its quota.
+	 */
+	static BaseType_t prvIsWithinQuota( UBaseType_t uxAccount, size_t xBlockSize );
+
+	/*
+	 * Return the most a request for xWantedSize bytes can be charged to an
+	 * account, which is the size of the object that serves it if xFromSlab is
+	 * pdTRUE, and otherwise the size of the block prvAllocateBlock() can
+	 * return for it.
+	 */
+	static size_t prvGetChargedSize( size_t xWantedSize, BaseType_t xFromSlab );
+
+	/*
+	 * Charge the allocated block pxLink to the account uxAccount, or credit it
+	 * back to the account it was charged to as it is freed.
+	 */
+	static void prvChargeAccount( BlockLink_t *pxLink, UBaseType_t uxAccount );
+	static void prvCreditAccount( const BlockLink_t *pxLink );
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+
+#if( configUSE_HEAP_SLABS == 1 )
+
+	/*
+	 * Take an object from the size class that serves requests of xWantedSize
+	 * bytes, refilling the class with a chunk from the list of free blocks if
+	 * it is empty.  Returns NULL if the request is too large for any class, or
+	 * the class could not be refilled.
+	 */
+	static void *prvSlabAllocate( size_t xWantedSize );
+
+	/*
+	 * Return the object pv, which has the header pxLink, to the cache of the
+	 * class it came from.
+	 */
+	static void prvSlabFree( void *pv, BlockLink_t *pxLink );
+
+	/*
+	 * Put the object pxLink back on the list of its class and, if none of the
+	 * objects of the chunk it was carved from are then in use, return the
+	 * chunk to the list of free blocks.
+	 */
+	static void prvSlabReturnObject( BlockLink_t *pxLink );
+
+#endif /* configUSE_HEAP_SLABS */
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+
+	/*
+	 * Return the object pxLink, which was allocated by pvPortMallocFromISR(),
+	 * to the interrupt cache of its class.  Must be called with interrupts
+	 * masked.
+	 */
+	static void prvISRCacheFree( BlockLink_t *pxLink );
+
+	/*
+	 * Bring the number of objects each class that has been used from an
+	 * interrupt holds for interrupts back to configHEAP_ISR_CACHE_OBJECTS, by
+	 * taking objects from, or giving objects back to, the class's cache for
+	 * tasks.  Must be called with the scheduler suspended.
+	 */
+	static void prvRefillISRCaches( void );
+
+#endif /* configUSE_HEAP_ISR_CACHE */
+
 /*
  * Called automatically to setup the required heap structures the first time
  * pvPortMalloc() is called.
@@ -146,45 +286,1178 @@ application.  When the bit is free the block is still part of the free heap
 space. */
 static size_t xBlockAllocatedBit = 0;
 
+/* Statistics returned by vPortGetHeapStats() that are maintained as blocks are
+allocated and freed, rather than calculated each time they are requested. */
+static size_t xNumberOfFreeBlocks = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+static size_t xLiveAllocations[ configHEAP_STATS_HISTOGRAM_BUCKETS ] = { 0U };
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	/* The heap usage of one task.  An account stays in use after its task is
+	deleted, with xTask set to NULL, until the blocks charged to it have all
+	been freed. */
+	typedef struct HEAP_TASK_ACCOUNT
+	{
+		TaskHandle_t xTask;
+		BaseType_t xInUse;
+		TaskHeapUsage_t xUsage;
+	} HeapTaskAccount_t;
+
+	static HeapTaskAccount_t xTaskAccounts[ configHEAP_ACCOUNTING_MAX_TASKS ];
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+
+#if( configUSE_HEAP_CANARIES == 1 )
+
+	/* The last free block checked by xPortHeapVerifyStep(), which continues
+	from the block that follows it.  If the block is taken out of the list of
+	free blocks the cursor is moved back to the block before it. */
+	static BlockLink_t *pxVerifyCursor = NULL;
+
+	/* Called if a corrupted block is found. */
+	extern void vApplicationHeapCorruptionHook( void *pvBlock );
+
+#endif /* configUSE_HEAP_CANARIES */
+
+#if( configUSE_HEAP_SLABS == 1 )
+
+	#if( ( configHEAP_SLAB_GRANULARITY % portBYTE_ALIGNMENT ) != 0 )
+		#error configHEAP_SLAB_GRANULARITY must be a multiple of portBYTE_ALIGNMENT
+	#endif
+
+	/* Class n serves requests of up to ( n + 1 ) * configHEAP_SLAB_GRANULARITY
+	bytes. */
+	#define heapSLAB_CLASS_SIZE( uxClass )	( ( ( size_t ) ( uxClass ) + ( size_t ) 1 ) * ( size_t ) configHEAP_SLAB_GRANULARITY )
+	#define heapSLAB_MAX_OBJECT_SIZE		heapSLAB_CLASS_SIZE( configHEAP_SLAB_CLASS_COUNT - 1 )
+
+	/* The class that serves a request of xWantedSize bytes, where xWantedSize
+	is not 0 and not greater than heapSLAB_MAX_OBJECT_SIZE. */
+	#define heapSLAB_CLASS_FOR( xWantedSize )	( ( UBaseType_t ) ( ( ( xWantedSize ) - ( size_t ) 1 ) / ( size_t ) configHEAP_SLAB_GRANULARITY ) )
+
+	/* The space taken by an object of class uxClass, including its header
+	and, if configUSE_HEAP_CANARIES is 1, an aligned trailer canary. */
+	#if( configUSE_HEAP_CANARIES == 1 )
+		#define heapSLAB_OBJECT_SIZE( uxClass )	( xHeapStructSize + heapSLAB_CLASS_SIZE( uxClass ) + ( ( heapTRAILER_SIZE + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) )
+	#else
+		#define heapSLAB_OBJECT_SIZE( uxClass )	( xHeapStructSize + heapSLAB_CLASS_SIZE( uxClass ) )
+	#endif
+
+	/* Objects cached by the size classes keep a BlockLink_t header, so
+	vPortFree() can tell them apart from other blocks.  The xBlockSize member of
+	the header holds xBlockAllocatedBit, heapSLAB_BIT and the class of the
+	object.  No block can be large enough to have heapSLAB_BIT set in its
+	size. */
+	#define heapSLAB_BIT					( xBlockAllocatedBit >> 1 )
+
+	/* Below heapSLAB_BIT the xBlockSize member of an object's header holds
+	the class of the object in its low heapSLAB_CLASS_BITS bits, and above them
+	the index of the object in the chunk it was carved from. */
+	#define heapSLAB_CLASS_BITS				( 8 )
+	#define heapSLAB_CLASS_MASK				( ( ( size_t ) 1 << heapSLAB_CLASS_BITS ) - ( size_t ) 1 )
+	#define heapSLAB_CLASS_OF( pxLink )		( ( UBaseType_t ) ( ( pxLink )->xBlockSize & heapSLAB_CLASS_MASK ) )
+	#define heapSLAB_INDEX_OF( pxLink )		( ( ( pxLink )->xBlockSize & ~( xBlockAllocatedBit | heapSLAB_BIT | heapISR_BIT ) ) >> heapSLAB_CLASS_BITS )
+
+	#if( configHEAP_SLAB_CLASS_COUNT > 256 )
+		#error configHEAP_SLAB_CLASS_COUNT must not be greater than 256
+	#endif
+
+	/* A chunk starts with a BlockLink_t whose xBlockSize member counts the
+	chunk's objects that are in use, either allocated or held for interrupts,
+	followed by configHEAP_SLAB_REFILL_OBJECTS objects.  The chunk is returned
+	to the list of free blocks when the count falls to zero. */
+	#define heapSLAB_CHUNK_OF( pxLink, uxClass )	( ( BlockLink_t * ) ( void * ) ( ( ( uint8_t * ) ( pxLink ) ) - ( heapSLAB_INDEX_OF( pxLink ) * heapSLAB_OBJECT_SIZE( uxClass ) ) - xHeapStructSize ) )
+
+	/* The objects cached by each class, linked through their pxNextFreeBlock
+	members, and the statistics of each class. */
+	static BlockLink_t *pxSlabFreeLists[ configHEAP_SLAB_CLASS_COUNT ] = { NULL };
+	static HeapSlabStats_t xSlabStats[ configHEAP_SLAB_CLASS_COUNT ];
+
+#endif /* configUSE_HEAP_SLABS */
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+
+	/* Objects that belong to the interrupt caches have heapISR_BIT set in
+	their xBlockSize member, as well as heapSLAB_BIT, both while cached and
+	while allocated, so vPortFree() can return them to the right cache. */
+	#define heapISR_BIT						( xBlockAllocatedBit >> 2 )
+
+	/* The objects each class holds for pvPortMallocFromISR(), linked through
+	their pxNextFreeBlock members.  Only accessed with interrupts masked, so
+	the interrupt path never waits for a task to resume the scheduler. */
+	static BlockLink_t *pxISRFreeLists[ configHEAP_SLAB_CLASS_COUNT ] = { NULL };
+	static UBaseType_t uxISRObjectsFree[ configHEAP_SLAB_CLASS_COUNT ] = { 0U };
+	static uint32_t ulISRMisses[ configHEAP_SLAB_CLASS_COUNT ] = { 0UL };
+
+	/* A class is only kept topped up once it has been requested from an
+	interrupt, or if it is in configHEAP_ISR_CACHE_CLASSES, so no memory is
+	held for classes interrupts do not use. */
+	static BaseType_t xISRClassUsed[ configHEAP_SLAB_CLASS_COUNT ] = { pdFALSE };
+
+	#define heapISR_CLASS_RESERVED( uxClass )	( ( ( uxClass ) < ( UBaseType_t ) 32 ) && ( ( ( ( uint32_t ) configHEAP_ISR_CACHE_CLASSES ) & ( ( ( uint32_t ) 1 ) << ( uxClass ) ) ) != 0UL ) )
+
+	/* Set by the interrupt path when a cache needs topping up, and cleared by
+	prvRefillISRCaches().  Starts set if any classes are reserved, so they are
+	filled by the first call to pvPortMalloc() and the first request for them
+	from an interrupt does not fail. */
+	static volatile BaseType_t xISRRefillPending = ( ( configHEAP_ISR_CACHE_CLASSES != 0 ) ? pdTRUE : pdFALSE );
+
+#else
+
+	#define heapISR_BIT						( ( size_t ) 0 )
+
+#endif /* configUSE_HEAP_ISR_CACHE */
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
 {
-BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
+BaseType_t xWithinQuota = pdTRUE;
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+	UBaseType_t uxAccount;
+#endif
 
 	vTaskSuspendAll();
 	{
-		/* If this is the first call to malloc then the heap will require
-		initialisation to setup the list of free blocks. */
-		if( pxEnd == NULL )
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the list of free blocks. */
+		if( pxEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if( configUSE_HEAP_ISR_CACHE == 1 )
+		{
+			/* Top up the caches interrupts have taken objects from, as the
+			scheduler is already suspended. */
+			if( xISRRefillPending != pdFALSE )
+			{
+				prvRefillISRCaches();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		#if( configUSE_HEAP_ACCOUNTING == 1 )
+		{
+			/* Blocks are charged to the calling task once the scheduler has
+			been started. */
+			if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+			{
+				uxAccount = prvFindAccount( xTaskGetCurrentTaskHandle(), pdTRUE );
+			}
+			else
+			{
+				uxAccount = 0;
+			}
+		}
+		#endif
+
+		#if( configUSE_HEAP_SLABS == 1 )
+		{
+			/* Small requests are served from the size class caches where
+			possible, which avoids walking the list of free blocks. */
+			if( ( xWantedSize > 0 ) && ( xWantedSize <= heapSLAB_MAX_OBJECT_SIZE ) )
+			{
+				#if( configUSE_HEAP_ACCOUNTING == 1 )
+				{
+					xWithinQuota = prvIsWithinQuota( uxAccount, prvGetChargedSize( xWantedSize, pdTRUE ) );
+				}
+				#endif
+
+				if( xWithinQuota != pdFALSE )
+				{
+					pvReturn = prvSlabAllocate( xWantedSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		if( ( pvReturn == NULL ) && ( xWithinQuota != pdFALSE ) )
+		{
+			#if( configUSE_HEAP_ACCOUNTING == 1 )
+			{
+				/* The block can be larger than an object of the class that
+				could not be refilled, so check the quota again. */
+				xWithinQuota = prvIsWithinQuota( uxAccount, prvGetChargedSize( xWantedSize, pdFALSE ) );
+			}
+			#endif
+
+			if( xWithinQuota != pdFALSE )
+			{
+				pvReturn = prvAllocateBlock( xWantedSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pvReturn != NULL )
+		{
+			prvUpdateAllocationStats( ( BlockLink_t * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize ), pdTRUE );
+
+			#if( configUSE_HEAP_ACCOUNTING == 1 )
+			{
+				prvChargeAccount( ( BlockLink_t * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize ), uxAccount );
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+		traceMALLOC_REQUESTED( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_HEAP_QUOTA_HOOK == 1 )
+	{
+		if( xWithinQuota == pdFALSE )
+		{
+			extern void vApplicationHeapQuotaHook( TaskHandle_t xTask, size_t xWantedSize );
+			vApplicationHeapQuotaHook( xTaskGetCurrentTaskHandle(), xWantedSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( uint32_t ) pvReturn ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvAllocateBlock( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+
+	/* Check the requested block size is not so large that the top bit is
+	set.  The top bit of the block size member of the BlockLink_t structure
+	is used to determine who owns the block - the application or the
+	kernel, so it must be free. */
+	if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+	{
+		/* The wanted size is increased so it can contain a BlockLink_t
+		structure in addition to the requested amount of bytes. */
+		if( xWantedSize > 0 )
+		{
+			xWantedSize += xHeapStructSize;
+
+			#if( configUSE_HEAP_CANARIES == 1 )
+			{
+				/* Leave room for the trailer canary at the end of the block. */
+				xWantedSize += heapTRAILER_SIZE;
+			}
+			#endif
+
+			/* Ensure that blocks are always aligned to the required number
+			of bytes. */
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				/* Byte alignment required. */
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+				configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+		{
+			/* Traverse the list from the start	(lowest address) block until
+			one	of adequate size is found. */
+			pxPreviousBlock = &xStart;
+			pxBlock = xStart.pxNextFreeBlock;
+			while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+			{
+				pxPreviousBlock = pxBlock;
+				pxBlock = pxBlock->pxNextFreeBlock;
+			}
+
+			/* If the end marker was reached then a block of adequate size
+			was	not found. */
+			if( pxBlock != pxEnd )
+			{
+				/* Return the memory space pointed to - jumping over the
+				BlockLink_t structure at its start. */
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + xHeapStructSize );
+
+				/* This block is being returned for use so must be taken out
+				of the list of free blocks. */
+				pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+				xNumberOfFreeBlocks--;
+
+				#if( configUSE_HEAP_CANARIES == 1 )
+				{
+					if( pxVerifyCursor == pxBlock )
+					{
+						pxVerifyCursor = pxPreviousBlock;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				/* If the block is larger than required it can be split into
+				two. */
+				if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+				{
+					/* This block is to be split into two.  Create a new
+					block following the number of bytes requested. The void
+					cast is used to prevent byte alignment warnings from the
+					compiler. */
+					pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+					configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+					/* Calculate the sizes of two blocks split from the
+					single block. */
+					pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxBlock->xBlockSize = xWantedSize;
+
+					/* Insert the new block into the list of free blocks. */
+					prvInsertBlockIntoFreeList( pxNewBlockLink );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block is being returned - it is allocated and owned
+				by the application and has no "next" block. */
+				pxBlock->xBlockSize |= xBlockAllocatedBit;
+				pxBlock->pxNextFreeBlock = NULL;
+
+				#if( configUSE_HEAP_CANARIES == 1 )
+				{
+					prvSetCanaries( pxBlock );
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink;
+BaseType_t xIntact = pdTRUE;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have an BlockLink_t structure immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		#if( configUSE_HEAP_CANARIES == 1 )
+		{
+			/* Check nothing has written over the header, or past the end of
+			the block, before the header is used.  A corrupted block is not
+			returned to the heap. */
+			xIntact = prvAreCanariesIntact( pxLink, pdTRUE );
+
+			if( xIntact == pdFALSE )
+			{
+				vApplicationHeapCorruptionHook( pv );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+		configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+		if( ( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 ) && ( xIntact != pdFALSE ) )
+		{
+			if( pxLink->pxNextFreeBlock == NULL )
+			{
+				#if( configUSE_HEAP_ISR_CACHE == 1 )
+				if( ( pxLink->xBlockSize & heapISR_BIT ) != 0 )
+				{
+					/* The object was allocated by pvPortMallocFromISR() so goes
+					back to the interrupt cache.  It was not counted in the
+					statistics or charged to an account when it was
+					allocated. */
+					traceFREE( pv, prvGetAllocatedBlockSize( pxLink ) );
+
+					taskENTER_CRITICAL();
+					{
+						prvISRCacheFree( pxLink );
+					}
+					taskEXIT_CRITICAL();
+				}
+				else
+				#endif /* configUSE_HEAP_ISR_CACHE */
+				#if( configUSE_HEAP_SLABS == 1 )
+				if( ( pxLink->xBlockSize & heapSLAB_BIT ) != 0 )
+				{
+					/* The block is an object from a size class cache, so goes
+					back to that cache rather than to the list of free blocks. */
+					vTaskSuspendAll();
+					{
+						prvUpdateAllocationStats( pxLink, pdFALSE );
+
+						#if( configUSE_HEAP_ACCOUNTING == 1 )
+						{
+							prvCreditAccount( pxLink );
+						}
+						#endif
+
+						prvSlabFree( pv, pxLink );
+					}
+					( void ) xTaskResumeAll();
+				}
+				else
+				#endif /* configUSE_HEAP_SLABS */
+				{
+					/* The block is being returned to the heap - it is no longer
+					allocated. */
+					pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+					vTaskSuspendAll();
+					{
+						prvUpdateAllocationStats( pxLink, pdFALSE );
+
+						#if( configUSE_HEAP_ACCOUNTING == 1 )
+						{
+							prvCreditAccount( pxLink );
+						}
+						#endif
+
+						/* Add this block to the list of free blocks. */
+						xFreeBytesRemaining += pxLink->xBlockSize;
+						traceFREE( pv, pxLink->xBlockSize );
+						prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+					}
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+size_t xMaxSize = 0, xMinSize = ~( ( size_t ) 0 );
+UBaseType_t x;
+
+	vTaskSuspendAll();
+	{
+		/* The largest and smallest free blocks are the only statistics that
+		require the list of free blocks to be walked.  The list is empty until
+		the heap has been initialised. */
+		pxBlock = xStart.pxNextFreeBlock;
+
+		if( pxBlock != NULL )
+		{
+			while( pxBlock != pxEnd )
+			{
+				if( pxBlock->xBlockSize > xMaxSize )
+				{
+					xMaxSize = pxBlock->xBlockSize;
+				}
+
+				if( pxBlock->xBlockSize < xMinSize )
+				{
+					xMinSize = pxBlock->xBlockSize;
+				}
+
+				pxBlock = pxBlock->pxNextFreeBlock;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+
+		for( x = 0; x < ( UBaseType_t ) configHEAP_STATS_HISTOGRAM_BUCKETS; x++ )
+		{
+			pxHeapStats->xLiveAllocations[ x ] = xLiveAllocations[ x ];
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( xMaxSize == 0 )
+	{
+		/* There are no free blocks. */
+		xMinSize = 0;
+	}
+
+	pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+	pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUpdateAllocationStats( const BlockLink_t *pxLink, BaseType_t xAllocated )
+{
+size_t xBlockSize;
+UBaseType_t uxBucket = 0;
+
+	xBlockSize = prvGetAllocatedBlockSize( pxLink );
+
+	/* Bucket n counts blocks of less than 2^( n + 5 ) bytes, and other than
+	bucket 0, at least 2^( n + 4 ) bytes.  The last bucket also counts any
+	larger blocks. */
+	xBlockSize >>= 4;
+
+	while( ( xBlockSize > ( size_t ) 1 ) && ( uxBucket < ( UBaseType_t ) ( configHEAP_STATS_HISTOGRAM_BUCKETS - 1 ) ) )
+	{
+		xBlockSize >>= 1;
+		uxBucket++;
+	}
+
+	if( xAllocated != pdFALSE )
+	{
+		xNumberOfSuccessfulAllocations++;
+		( xLiveAllocations[ uxBucket ] )++;
+	}
+	else
+	{
+		xNumberOfSuccessfulFrees++;
+		( xLiveAllocations[ uxBucket ] )--;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvGetAllocatedBlockSize( const BlockLink_t *pxLink )
+{
+size_t xBlockSize;
+
+	#if( configUSE_HEAP_SLABS == 1 )
+	if( ( pxLink->xBlockSize & heapSLAB_BIT ) != 0 )
+	{
+		/* The size member of a cached object holds its class. */
+		xBlockSize = heapSLAB_OBJECT_SIZE( heapSLAB_CLASS_OF( pxLink ) );
+	}
+	else
+	#endif /* configUSE_HEAP_SLABS */
+	{
+		xBlockSize = pxLink->xBlockSize & ~xBlockAllocatedBit;
+	}
+
+	return xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_CANARIES == 1 )
+
+	static void prvSetCanaries( BlockLink_t *pxLink )
+	{
+	size_t *pxTrailer;
+
+		pxLink->xCanary = heapHEADER_CANARY( pxLink );
+
+		if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+		{
+			pxTrailer = ( size_t * ) ( void * ) ( ( ( uint8_t * ) pxLink ) + prvGetAllocatedBlockSize( pxLink ) - heapTRAILER_SIZE );
+			*pxTrailer = heapTRAILER_CANARY( pxLink );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_HEAP_CANARIES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_CANARIES == 1 )
+
+	static BaseType_t prvAreCanariesIntact( const BlockLink_t *pxLink, BaseType_t xCheckTrailer )
+	{
+	const size_t *pxTrailer;
+	BaseType_t xReturn = pdTRUE;
+
+		if( pxLink->xCanary != heapHEADER_CANARY( pxLink ) )
+		{
+			xReturn = pdFALSE;
+		}
+		else if( xCheckTrailer != pdFALSE )
+		{
+			/* The header is intact, so the size used to locate the trailer
+			can be trusted. */
+			pxTrailer = ( const size_t * ) ( const void * ) ( ( ( const uint8_t * ) pxLink ) + prvGetAllocatedBlockSize( pxLink ) - heapTRAILER_SIZE );
+
+			if( *pxTrailer != heapTRAILER_CANARY( pxLink ) )
+			{
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_HEAP_CANARIES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_CANARIES == 1 )
+
+	BaseType_t xPortHeapVerifyStep( void )
+	{
+	BlockLink_t *pxBlock;
+	UBaseType_t uxChecked;
+	BaseType_t xPassComplete = pdFALSE;
+	void *pvCorruptBlock = NULL;
+
+		vTaskSuspendAll();
+		{
+			if( pxVerifyCursor == NULL )
+			{
+				pxVerifyCursor = &xStart;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			for( uxChecked = 0; uxChecked < ( UBaseType_t ) configHEAP_VERIFY_BLOCKS_PER_STEP; uxChecked++ )
+			{
+				pxBlock = pxVerifyCursor->pxNextFreeBlock;
+
+				if( pxBlock == NULL )
+				{
+					/* The heap has not been initialised yet. */
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Free blocks are held in address order and never overlap.
+				xStart is not part of the heap so is not compared. */
+				if( ( prvAreCanariesIntact( pxBlock, pdFALSE ) == pdFALSE ) ||
+					( ( pxVerifyCursor != &xStart ) && ( ( ( ( uint8_t * ) pxVerifyCursor ) + pxVerifyCursor->xBlockSize ) > ( uint8_t * ) pxBlock ) ) )
+				{
+					pvCorruptBlock = ( void * ) pxBlock;
+					pxVerifyCursor = &xStart;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( pxBlock == pxEnd )
+				{
+					/* Every free block has been checked, start again next
+					time. */
+					pxVerifyCursor = &xStart;
+					xPassComplete = pdTRUE;
+					break;
+				}
+				else
+				{
+					pxVerifyCursor = pxBlock;
+				}
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		if( pvCorruptBlock != NULL )
+		{
+			vApplicationHeapCorruptionHook( pvCorruptBlock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xPassComplete;
+	}
+
+#endif /* configUSE_HEAP_CANARIES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	static UBaseType_t prvFindAccount( TaskHandle_t xTask, BaseType_t xCreate )
+	{
+	UBaseType_t x, uxAccount = 0, uxUnused = 0;
+
+		for( x = 0; x < ( UBaseType_t ) configHEAP_ACCOUNTING_MAX_TASKS; x++ )
+		{
+			if( xTaskAccounts[ x ].xInUse == pdFALSE )
+			{
+				if( uxUnused == 0 )
+				{
+					uxUnused = x + 1;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( xTaskAccounts[ x ].xTask == xTask )
+			{
+				uxAccount = x + 1;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( ( uxAccount == 0 ) && ( xCreate != pdFALSE ) && ( uxUnused != 0 ) )
+		{
+			uxAccount = uxUnused;
+			xTaskAccounts[ uxAccount - 1 ].xTask = xTask;
+			xTaskAccounts[ uxAccount - 1 ].xInUse = pdTRUE;
+			xTaskAccounts[ uxAccount - 1 ].xUsage.xLiveBytes = 0;
+			xTaskAccounts[ uxAccount - 1 ].xUsage.xPeakBytes = 0;
+			xTaskAccounts[ uxAccount - 1 ].xUsage.xQuotaBytes = 0;
+			xTaskAccounts[ uxAccount - 1 ].xUsage.ulQuotaFailures = 0;
+		}
+		else
+		{
+			/* Either the task already has an account, or there are none left,
+			in which case the task's blocks are not charged to any account. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxAccount;
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	static BaseType_t prvIsWithinQuota( UBaseType_t uxAccount, size_t xBlockSize )
+	{
+	TaskHeapUsage_t *pxUsage;
+	BaseType_t xReturn = pdTRUE;
+
+		if( uxAccount != 0 )
+		{
+			pxUsage = &( xTaskAccounts[ uxAccount - 1 ].xUsage );
+
+			if( pxUsage->xQuotaBytes != 0 )
+			{
+				/* Written so it cannot overflow. */
+				if( ( pxUsage->xLiveBytes > pxUsage->xQuotaBytes ) || ( xBlockSize > ( pxUsage->xQuotaBytes - pxUsage->xLiveBytes ) ) )
+				{
+					( pxUsage->ulQuotaFailures )++;
+					xReturn = pdFALSE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	static size_t prvGetChargedSize( size_t xWantedSize, BaseType_t xFromSlab )
+	{
+	size_t xBlockSize = xWantedSize;
+
+		/* prvAllocateBlock() refuses a request this large, so nothing is
+		added to it in case that overflows. */
+		if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+		{
+			/* Add the header, trailer canary and alignment padding as
+			prvAllocateBlock() does. */
+			xBlockSize += xHeapStructSize;
+
+			#if( configUSE_HEAP_CANARIES == 1 )
+			{
+				xBlockSize += heapTRAILER_SIZE;
+			}
+			#endif
+
+			xBlockSize = ( xBlockSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+			/* A free block is only split if the remainder would be larger
+			than heapMINIMUM_BLOCK_SIZE, so the block returned can be up to
+			that much larger again. */
+			xBlockSize += heapMINIMUM_BLOCK_SIZE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if( configUSE_HEAP_SLABS == 1 )
+		{
+			if( xFromSlab != pdFALSE )
+			{
+				/* Objects are charged the size of the class that serves
+				them. */
+				xBlockSize = heapSLAB_OBJECT_SIZE( heapSLAB_CLASS_FOR( xWantedSize ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			( void ) xFromSlab;
+		}
+		#endif
+
+		return xBlockSize;
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	static void prvChargeAccount( BlockLink_t *pxLink, UBaseType_t uxAccount )
+	{
+	TaskHeapUsage_t *pxUsage;
+
+		pxLink->uxAccount = uxAccount;
+
+		if( uxAccount != 0 )
+		{
+			pxUsage = &( xTaskAccounts[ uxAccount - 1 ].xUsage );
+			pxUsage->xLiveBytes += prvGetAllocatedBlockSize( pxLink );
+
+			if( pxUsage->xLiveBytes > pxUsage->xPeakBytes )
+			{
+				pxUsage->xPeakBytes = pxUsage->xLiveBytes;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	static void prvCreditAccount( const BlockLink_t *pxLink )
+	{
+	HeapTaskAccount_t *pxAccount;
+	size_t xBlockSize;
+
+		if( pxLink->uxAccount != 0 )
+		{
+			configASSERT( pxLink->uxAccount <= ( UBaseType_t ) configHEAP_ACCOUNTING_MAX_TASKS );
+			pxAccount = &( xTaskAccounts[ pxLink->uxAccount - 1 ] );
+			xBlockSize = prvGetAllocatedBlockSize( pxLink );
+
+			configASSERT( pxAccount->xUsage.xLiveBytes >= xBlockSize );
+			pxAccount->xUsage.xLiveBytes -= xBlockSize;
+
+			/* The account of a deleted task is released once the last block
+			charged to it is freed. */
+			if( ( pxAccount->xTask == NULL ) && ( pxAccount->xUsage.xLiveBytes == 0 ) )
+			{
+				pxAccount->xInUse = pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	void vPortSetTaskHeapQuota( void *pvTask, size_t xQuotaBytes )
+	{
+	UBaseType_t uxAccount;
+
+		if( pvTask == NULL )
+		{
+			pvTask = xTaskGetCurrentTaskHandle();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskSuspendAll();
+		{
+			uxAccount = prvFindAccount( ( TaskHandle_t ) pvTask, pdTRUE );
+
+			/* If this fails configHEAP_ACCOUNTING_MAX_TASKS is too low. */
+			configASSERT( uxAccount != 0 );
+
+			if( uxAccount != 0 )
+			{
+				xTaskAccounts[ uxAccount - 1 ].xUsage.xQuotaBytes = xQuotaBytes;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	BaseType_t xPortGetTaskHeapUsage( void *pvTask, TaskHeapUsage_t *pxUsage )
+	{
+	UBaseType_t uxAccount;
+	BaseType_t xReturn = pdFAIL;
+
+		if( pvTask == NULL )
+		{
+			pvTask = xTaskGetCurrentTaskHandle();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskSuspendAll();
+		{
+			uxAccount = prvFindAccount( ( TaskHandle_t ) pvTask, pdFALSE );
+
+			if( uxAccount != 0 )
+			{
+				*pxUsage = xTaskAccounts[ uxAccount - 1 ].xUsage;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+
+	void vPortHeapTaskDeleted( void *pvTask )
+	{
+	UBaseType_t uxAccount;
+
+		/* Called by vTaskDelete() from a critical section, so the accounts
+		cannot be accessed by any other task. */
+		uxAccount = prvFindAccount( ( TaskHandle_t ) pvTask, pdFALSE );
+
+		if( uxAccount != 0 )
 		{
-			prvHeapInit();
+			if( xTaskAccounts[ uxAccount - 1 ].xUsage.xLiveBytes == 0 )
+			{
+				xTaskAccounts[ uxAccount - 1 ].xInUse = pdFALSE;
+			}
+			else
+			{
+				/* Keep the account until the blocks charged to it are freed,
+				but make sure it is not found using the task's handle. */
+				xTaskAccounts[ uxAccount - 1 ].xTask = NULL;
+			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+	}
 
-		/* Check the requested block size is not so large that the top bit is
-		set.  The top bit of the block size member of the BlockLink_t structure
-		is used to determine who owns the block - the application or the
-		kernel, so it must be free. */
-		if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_SLABS == 1 )
+
+	static void *prvSlabAllocate( size_t xWantedSize )
+	{
+	UBaseType_t uxClass, uxObject;
+	BlockLink_t *pxObject, *pxChunk;
+	uint8_t *pucChunk;
+	size_t xObjectSize;
+	void *pvReturn = NULL;
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= heapSLAB_MAX_OBJECT_SIZE ) )
 		{
-			/* The wanted size is increased so it can contain a BlockLink_t
-			structure in addition to the requested amount of bytes. */
-			if( xWantedSize > 0 )
-			{
-				xWantedSize += xHeapStructSize;
+			uxClass = heapSLAB_CLASS_FOR( xWantedSize );
 
-				/* Ensure that blocks are always aligned to the required number
-				of bytes. */
-				if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			if( pxSlabFreeLists[ uxClass ] == NULL )
+			{
+				/* The class is empty so refill it with a chunk of
+				configHEAP_SLAB_REFILL_OBJECTS objects taken from the list of
+				free blocks.  The object index must fit below the flag bits
+				of the header. */
+				configASSERT( ( ( ( size_t ) configHEAP_SLAB_REFILL_OBJECTS ) << heapSLAB_CLASS_BITS ) < ( heapSLAB_BIT >> 1 ) );
+				xSlabStats[ uxClass ].ulMisses++;
+				xObjectSize = heapSLAB_OBJECT_SIZE( uxClass );
+				pucChunk = ( uint8_t * ) prvAllocateBlock( xHeapStructSize + ( xObjectSize * ( size_t ) configHEAP_SLAB_REFILL_OBJECTS ) );
+
+				if( pucChunk != NULL )
 				{
-					/* Byte alignment required. */
-					xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
-					configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+					pxChunk = ( void * ) pucChunk;
+					pxChunk->pxNextFreeBlock = NULL;
+					pxChunk->xBlockSize = 0;
+					pucChunk += xHeapStructSize;
+
+					for( uxObject = 0; uxObject < ( UBaseType_t ) configHEAP_SLAB_REFILL_OBJECTS; uxObject++ )
+					{
+						pxObject = ( void * ) pucChunk;
+						pxObject->xBlockSize = xBlockAllocatedBit | heapSLAB_BIT | ( ( size_t ) uxObject << heapSLAB_CLASS_BITS ) | ( size_t ) uxClass;
+						#if( configUSE_HEAP_CANARIES == 1 )
+						{
+							prvSetCanaries( pxObject );
+						}
+						#endif
+						pxObject->pxNextFreeBlock = pxSlabFreeLists[ uxClass ];
+						pxSlabFreeLists[ uxClass ] = pxObject;
+						pucChunk += xObjectSize;
+					}
+
+					xSlabStats[ uxClass ].uxObjectsFree += ( UBaseType_t ) configHEAP_SLAB_REFILL_OBJECTS;
 				}
 				else
 				{
@@ -193,77 +1466,224 @@ void *pvReturn = NULL;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				xSlabStats[ uxClass ].ulHits++;
 			}
 
-			if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+			pxObject = pxSlabFreeLists[ uxClass ];
+
+			if( pxObject != NULL )
 			{
-				/* Traverse the list from the start	(lowest address) block until
-				one	of adequate size is found. */
-				pxPreviousBlock = &xStart;
-				pxBlock = xStart.pxNextFreeBlock;
-				while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
-				{
-					pxPreviousBlock = pxBlock;
-					pxBlock = pxBlock->pxNextFreeBlock;
-				}
+				/* The object is allocated, so like any other allocated block
+				has no "next" block. */
+				pxSlabFreeLists[ uxClass ] = pxObject->pxNextFreeBlock;
+				pxObject->pxNextFreeBlock = NULL;
 
-				/* If the end marker was reached then a block of adequate size
-				was	not found. */
-				if( pxBlock != pxEnd )
-				{
-					/* Return the memory space pointed to - jumping over the
-					BlockLink_t structure at its start. */
-					pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + xHeapStructSize );
+				( xSlabStats[ uxClass ].uxObjectsFree )--;
+				( xSlabStats[ uxClass ].uxObjectsInUse )++;
+
+				pxChunk = heapSLAB_CHUNK_OF( pxObject, uxClass );
+				( pxChunk->xBlockSize )++;
+
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxObject ) + xHeapStructSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvReturn;
+	}
+
+#endif /* configUSE_HEAP_SLABS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_SLABS == 1 )
+
+	static void prvSlabFree( void *pv, BlockLink_t *pxLink )
+	{
+	UBaseType_t uxClass;
 
-					/* This block is being returned for use so must be taken out
-					of the list of free blocks. */
-					pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+		uxClass = heapSLAB_CLASS_OF( pxLink );
+		configASSERT( uxClass < ( UBaseType_t ) configHEAP_SLAB_CLASS_COUNT );
 
-					/* If the block is larger than required it can be split into
-					two. */
-					if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+		traceFREE( pv, heapSLAB_OBJECT_SIZE( uxClass ) );
+
+		prvSlabReturnObject( pxLink );
+
+		/* Only used by the trace macro. */
+		( void ) pv;
+		( void ) uxClass;
+	}
+
+#endif /* configUSE_HEAP_SLABS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_SLABS == 1 )
+
+	static void prvSlabReturnObject( BlockLink_t *pxLink )
+	{
+	UBaseType_t uxClass, uxObjectsFound = 0;
+	BlockLink_t *pxChunk, *pxBlock, *pxPreviousObject = NULL;
+	uint8_t *pucFirstObject, *pucEnd;
+
+		uxClass = heapSLAB_CLASS_OF( pxLink );
+		configASSERT( uxClass < ( UBaseType_t ) configHEAP_SLAB_CLASS_COUNT );
+
+		pxLink->pxNextFreeBlock = pxSlabFreeLists[ uxClass ];
+		pxSlabFreeLists[ uxClass ] = pxLink;
+
+		( xSlabStats[ uxClass ].uxObjectsInUse )--;
+		( xSlabStats[ uxClass ].uxObjectsFree )++;
+
+		pxChunk = heapSLAB_CHUNK_OF( pxLink, uxClass );
+		configASSERT( pxChunk->xBlockSize > ( size_t ) 0 );
+		( pxChunk->xBlockSize )--;
+
+		if( pxChunk->xBlockSize == ( size_t ) 0 )
+		{
+			/* None of the chunk's objects are in use, so all of them are on
+			the list of the class.  Take them off it, then return the chunk to
+			the list of free blocks so it can be merged with its neighbours
+			rather than holding memory the class does not need. */
+			pucFirstObject = ( ( uint8_t * ) pxChunk ) + xHeapStructSize;
+			pucEnd = pucFirstObject + ( heapSLAB_OBJECT_SIZE( uxClass ) * ( size_t ) configHEAP_SLAB_REFILL_OBJECTS );
+			pxBlock = pxSlabFreeLists[ uxClass ];
+
+			while( ( pxBlock != NULL ) && ( uxObjectsFound < ( UBaseType_t ) configHEAP_SLAB_REFILL_OBJECTS ) )
+			{
+				if( ( ( ( uint8_t * ) pxBlock ) >= pucFirstObject ) && ( ( ( uint8_t * ) pxBlock ) < pucEnd ) )
+				{
+					if( pxPreviousObject == NULL )
 					{
-						/* This block is to be split into two.  Create a new
-						block following the number of bytes requested. The void
-						cast is used to prevent byte alignment warnings from the
-						compiler. */
-						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
-						configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
-
-						/* Calculate the sizes of two blocks split from the
-						single block. */
-						pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-						pxBlock->xBlockSize = xWantedSize;
-
-						/* Insert the new block into the list of free blocks. */
-						prvInsertBlockIntoFreeList( pxNewBlockLink );
+						pxSlabFreeLists[ uxClass ] = pxBlock->pxNextFreeBlock;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						pxPreviousObject->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
 					}
 
-					xFreeBytesRemaining -= pxBlock->xBlockSize;
+					uxObjectsFound++;
+				}
+				else
+				{
+					pxPreviousObject = pxBlock;
+				}
+
+				pxBlock = pxBlock->pxNextFreeBlock;
+			}
+
+			configASSERT( uxObjectsFound == ( UBaseType_t ) configHEAP_SLAB_REFILL_OBJECTS );
+			xSlabStats[ uxClass ].uxObjectsFree -= uxObjectsFound;
+			( xSlabStats[ uxClass ].ulChunksReleased )++;
+
+			/* The chunk's header in the heap is immediately before the
+			BlockLink_t that counts its objects. */
+			pxBlock = ( BlockLink_t * ) ( void * ) ( ( ( uint8_t * ) pxChunk ) - xHeapStructSize );
+			pxBlock->xBlockSize &= ~xBlockAllocatedBit;
+
+			xFreeBytesRemaining += pxBlock->xBlockSize;
+			prvInsertBlockIntoFreeList( pxBlock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_HEAP_SLABS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_SLABS == 1 )
+
+	void vPortGetHeapSlabStats( UBaseType_t uxClass, HeapSlabStats_t *pxStats )
+	{
+		configASSERT( uxClass < ( UBaseType_t ) configHEAP_SLAB_CLASS_COUNT );
+
+		vTaskSuspendAll();
+		{
+			*pxStats = xSlabStats[ uxClass ];
+		}
+		( void ) xTaskResumeAll();
+
+		pxStats->xObjectSize = heapSLAB_CLASS_SIZE( uxClass );
+
+		#if( configUSE_HEAP_ISR_CACHE == 1 )
+		{
+			taskENTER_CRITICAL();
+			{
+				pxStats->uxISRObjectsFree = uxISRObjectsFree[ uxClass ];
+				pxStats->ulISRMisses = ulISRMisses[ uxClass ];
+			}
+			taskEXIT_CRITICAL();
+		}
+		#else
+		{
+			pxStats->uxISRObjectsFree = 0;
+			pxStats->ulISRMisses = 0;
+		}
+		#endif
+	}
+
+#endif /* configUSE_HEAP_SLABS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+
+	void *pvPortMallocFromISR( size_t xWantedSize )
+	{
+	UBaseType_t uxClass, uxWantedClass, uxSavedInterruptStatus;
+	BlockLink_t *pxObject = NULL;
+	void *pvReturn = NULL;
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= heapSLAB_MAX_OBJECT_SIZE ) )
+		{
+			uxWantedClass = ( UBaseType_t ) ( ( xWantedSize - 1 ) / configHEAP_SLAB_GRANULARITY );
+			uxClass = uxWantedClass;
+
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				xISRClassUsed[ uxWantedClass ] = pdTRUE;
+
+				/* If the class is empty the larger classes are tried in turn,
+				so the time taken is bounded by the number of classes. */
+				while( ( pxObject == NULL ) && ( uxClass < ( UBaseType_t ) configHEAP_SLAB_CLASS_COUNT ) )
+				{
+					pxObject = pxISRFreeLists[ uxClass ];
 
-					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					if( pxObject != NULL )
 					{
-						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+						pxISRFreeLists[ uxClass ] = pxObject->pxNextFreeBlock;
+						pxObject->pxNextFreeBlock = NULL;
+						( uxISRObjectsFree[ uxClass ] )--;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						uxClass++;
 					}
+				}
 
-					/* The block is being returned - it is allocated and owned
-					by the application and has no "next" block. */
-					pxBlock->xBlockSize |= xBlockAllocatedBit;
-					pxBlock->pxNextFreeBlock = NULL;
+				if( uxClass != uxWantedClass )
+				{
+					( ulISRMisses[ uxWantedClass ] )++;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				/* The cache is topped up again by a task. */
+				xISRRefillPending = pdTRUE;
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+			if( pxObject != NULL )
+			{
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxObject ) + xHeapStructSize );
 			}
 			else
 			{
@@ -276,86 +1696,217 @@ void *pvReturn = NULL;
 		}
 
 		traceMALLOC( pvReturn, xWantedSize );
-	}
-	( void ) xTaskResumeAll();
+		traceMALLOC_REQUESTED( pvReturn, xWantedSize );
 
-	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
-	{
-		if( pvReturn == NULL )
-		{
-			extern void vApplicationMallocFailedHook( void );
-			vApplicationMallocFailedHook();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		return pvReturn;
 	}
-	#endif
 
-	configASSERT( ( ( ( uint32_t ) pvReturn ) & portBYTE_ALIGNMENT_MASK ) == 0 );
-	return pvReturn;
-}
+#endif /* configUSE_HEAP_ISR_CACHE */
 /*-----------------------------------------------------------*/
 
-void vPortFree( void *pv )
-{
-uint8_t *puc = ( uint8_t * ) pv;
-BlockLink_t *pxLink;
+#if( configUSE_HEAP_ISR_CACHE == 1 )
 
-	if( pv != NULL )
+	void vPortFreeFromISR( void *pv )
 	{
-		/* The memory being freed will have an BlockLink_t structure immediately
-		before it. */
-		puc -= xHeapStructSize;
+	BlockLink_t *pxLink;
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xIntact = pdTRUE;
 
-		/* This casting is to keep the compiler from issuing warnings. */
-		pxLink = ( void * ) puc;
+		if( pv != NULL )
+		{
+			pxLink = ( void * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
 
-		/* Check the block is actually allocated. */
-		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
-		configASSERT( pxLink->pxNextFreeBlock == NULL );
+			#if( configUSE_HEAP_CANARIES == 1 )
+			{
+				xIntact = prvAreCanariesIntact( pxLink, pdTRUE );
 
-		if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
-		{
-			if( pxLink->pxNextFreeBlock == NULL )
+				if( xIntact == pdFALSE )
+				{
+					vApplicationHeapCorruptionHook( pv );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			/* Only blocks allocated by pvPortMallocFromISR() can be freed from
+			an interrupt. */
+			configASSERT( ( pxLink->xBlockSize & heapISR_BIT ) != 0 );
+			configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+			if( ( ( pxLink->xBlockSize & heapISR_BIT ) != 0 ) && ( pxLink->pxNextFreeBlock == NULL ) && ( xIntact != pdFALSE ) )
 			{
-				/* The block is being returned to the heap - it is no longer
-				allocated. */
-				pxLink->xBlockSize &= ~xBlockAllocatedBit;
+				traceFREE( pv, prvGetAllocatedBlockSize( pxLink ) );
 
-				vTaskSuspendAll();
+				uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 				{
-					/* Add this block to the list of free blocks. */
-					xFreeBytesRemaining += pxLink->xBlockSize;
-					traceFREE( pv, pxLink->xBlockSize );
-					prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+					prvISRCacheFree( pxLink );
 				}
-				( void ) xTaskResumeAll();
+				portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+	}
+
+#endif /* configUSE_HEAP_ISR_CACHE */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+
+	void vPortRefillISRCaches( void )
+	{
+		if( xISRRefillPending != pdFALSE )
+		{
+			vTaskSuspendAll();
+			{
+				prvRefillISRCaches();
+			}
+			( void ) xTaskResumeAll();
+		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-}
+
+#endif /* configUSE_HEAP_ISR_CACHE */
 /*-----------------------------------------------------------*/
 
-size_t xPortGetFreeHeapSize( void )
-{
-	return xFreeBytesRemaining;
-}
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+
+	static void prvISRCacheFree( BlockLink_t *pxLink )
+	{
+	UBaseType_t uxClass;
+
+		uxClass = heapSLAB_CLASS_OF( pxLink );
+		configASSERT( uxClass < ( UBaseType_t ) configHEAP_SLAB_CLASS_COUNT );
+
+		pxLink->pxNextFreeBlock = pxISRFreeLists[ uxClass ];
+		pxISRFreeLists[ uxClass ] = pxLink;
+		( uxISRObjectsFree[ uxClass ] )++;
+
+		if( uxISRObjectsFree[ uxClass ] > ( UBaseType_t ) configHEAP_ISR_CACHE_OBJECTS )
+		{
+			/* Give the extra objects back to tasks. */
+			xISRRefillPending = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_HEAP_ISR_CACHE */
 /*-----------------------------------------------------------*/
 
-size_t xPortGetMinimumEverFreeHeapSize( void )
-{
-	return xMinimumEverFreeBytesRemaining;
-}
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+
+	static void prvRefillISRCaches( void )
+	{
+	UBaseType_t uxClass;
+	BlockLink_t *pxObject;
+	BaseType_t xContinue;
+	void *pvObject;
+
+		/* Cleared first so a request made by an interrupt while the caches are
+		being refilled is not missed. */
+		xISRRefillPending = pdFALSE;
+
+		for( uxClass = 0; uxClass < ( UBaseType_t ) configHEAP_SLAB_CLASS_COUNT; uxClass++ )
+		{
+			/* Classes that have not been used by an interrupt, and are not
+			reserved, are left empty. */
+			if( heapISR_CLASS_RESERVED( uxClass ) )
+			{
+				xISRClassUsed[ uxClass ] = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xContinue = xISRClassUsed[ uxClass ];
+
+			while( xContinue != pdFALSE )
+			{
+				xContinue = pdFALSE;
+				pxObject = NULL;
+
+				taskENTER_CRITICAL();
+				{
+					if( uxISRObjectsFree[ uxClass ] > ( UBaseType_t ) configHEAP_ISR_CACHE_OBJECTS )
+					{
+						/* Objects freed by interrupts have overfilled the
+						cache, so one is given back to tasks. */
+						pxObject = pxISRFreeLists[ uxClass ];
+						pxISRFreeLists[ uxClass ] = pxObject->pxNextFreeBlock;
+						( uxISRObjectsFree[ uxClass ] )--;
+					}
+					else if( uxISRObjectsFree[ uxClass ] < ( UBaseType_t ) configHEAP_ISR_CACHE_OBJECTS )
+					{
+						xContinue = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				if( pxObject != NULL )
+				{
+					pxObject->xBlockSize &= ~heapISR_BIT;
+					#if( configUSE_HEAP_CANARIES == 1 )
+					{
+						prvSetCanaries( pxObject );
+					}
+					#endif
+					prvSlabReturnObject( pxObject );
+					xContinue = pdTRUE;
+				}
+				else if( xContinue != pdFALSE )
+				{
+					/* Objects for interrupts are taken from the cache for
+					tasks, which is refilled from the heap if necessary. */
+					pvObject = prvSlabAllocate( heapSLAB_CLASS_SIZE( uxClass ) );
+
+					if( pvObject != NULL )
+					{
+						pxObject = ( BlockLink_t * ) ( ( ( uint8_t * ) pvObject ) - xHeapStructSize );
+						pxObject->xBlockSize |= heapISR_BIT;
+						#if( configUSE_HEAP_CANARIES == 1 )
+						{
+							prvSetCanaries( pxObject );
+						}
+						#endif
+
+						taskENTER_CRITICAL();
+						{
+							prvISRCacheFree( pxObject );
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						/* The heap is exhausted.  The next request from an
+						interrupt will try again. */
+						xContinue = pdFALSE;
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+	}
+
+#endif /* configUSE_HEAP_ISR_CACHE */
 /*-----------------------------------------------------------*/
 
 void vPortInitialiseBlocks( void )
@@ -403,9 +1954,17 @@ size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
 	pxFirstFreeBlock->xBlockSize = uxAddress - ( size_t ) pxFirstFreeBlock;
 	pxFirstFreeBlock->pxNextFreeBlock = pxEnd;
 
+	#if( configUSE_HEAP_CANARIES == 1 )
+	{
+		prvSetCanaries( pxEnd );
+		prvSetCanaries( pxFirstFreeBlock );
+	}
+	#endif
+
 	/* Only one block exists - and it covers the entire usable heap space. */
 	xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
 	xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+	xNumberOfFreeBlocks = 1;
 
 	/* Work out the position of the top bit in a size_t variable. */
 	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
@@ -417,6 +1976,10 @@ static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert )
 BlockLink_t *pxIterator;
 uint8_t *puc;
 
+	/* The count is reduced again for each neighbour the block is merged
+	with. */
+	xNumberOfFreeBlocks++;
+
 	/* Iterate through the list until a block is found that has a higher address
 	than the block being inserted. */
 	for( pxIterator = &xStart; pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
@@ -431,6 +1994,7 @@ uint8_t *puc;
 	{
 		pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
 		pxBlockToInsert = pxIterator;
+		xNumberOfFreeBlocks--;
 	}
 	else
 	{
@@ -445,8 +2009,22 @@ uint8_t *puc;
 		if( pxIterator->pxNextFreeBlock != pxEnd )
 		{
 			/* Form one big block from the two blocks. */
+			#if( configUSE_HEAP_CANARIES == 1 )
+			{
+				if( pxVerifyCursor == pxIterator->pxNextFreeBlock )
+				{
+					pxVerifyCursor = pxBlockToInsert;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
 			pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+			xNumberOfFreeBlocks--;
 		}
 		else
 		{
@@ -470,5 +2048,12 @@ uint8_t *puc;
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
+
+	#if( configUSE_HEAP_CANARIES == 1 )
+	{
+		/* The size of the block may have changed as it was merged. */
+		prvSetCanaries( pxBlockToInsert );
+	}
+	#endif
 }
 
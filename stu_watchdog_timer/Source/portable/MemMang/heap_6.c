@@ -0,0 +1,821 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() that uses a two level segregated
+ * fit (TLSF) algorithm, so both pvPortMalloc() and vPortFree() execute in a
+ * bounded time that does not depend on the number of blocks in the heap or on
+ * how fragmented the heap has become.  Like heap_5.c the heap can be defined
+ * across multiple non-contiguous blocks of memory, and adjacent blocks are
+ * combined (coalesced) as soon as they are freed.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Free blocks are held in a matrix of lists.  The first level of the matrix
+ * divides block sizes into power of two ranges, and the second level divides
+ * each range into 2^heapSL_INDEX_COUNT_LOG2 equal sub-ranges.  A bitmap per
+ * level records which lists are not empty, so the smallest list that is
+ * guaranteed to hold a large enough block is found with two bit scans rather
+ * than a walk of the free list.  Each block also records the block that
+ * precedes it in memory, so a block being freed can be merged with both of
+ * its neighbours without searching for them.
+ *
+ * No single block can be larger than 2^configTLSF_MAX_BLOCK_SIZE_BITS bytes.
+ * Regions larger than that are split into several blocks that are never
+ * merged with each other.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc().
+ * pvPortMalloc() will be called if any task objects (tasks, queues, event
+ * groups, etc.) are created, therefore vPortDefineHeapRegions() ***must*** be
+ * called before any other objects are defined.
+ *
+ * vPortDefineHeapRegions() takes a single parameter.  The parameter is an array
+ * of HeapRegion_t structures.  HeapRegion_t is defined in portable.h as
+ *
+ * typedef struct HeapRegion
+ * {
+ *	uint8_t *pucStartAddress; << Start address of a block of memory that will be part of the heap.
+ *	size_t xSizeInBytes;	  << Size of the block of memory.
+ * } HeapRegion_t;
+ *
+ * The array is terminated using a NULL zero sized region definition.  Unlike
+ * heap_5.c the regions do not need to appear in address order, although they
+ * must not overlap.  The following is a valid example of how to use the
+ * function.
+ *
+ * HeapRegion_t xHeapRegions[] =
+ * {
+ * 	{ ( uint8_t * ) 0x80000000UL, 0x10000 }, << Defines a block of 0x10000 bytes starting at address 0x80000000
+ * 	{ ( uint8_t * ) 0x90000000UL, 0xa0000 }, << Defines a block of 0xa0000 bytes starting at address of 0x90000000
+ * 	{ NULL, 0 }                << Terminates the array.
+ * };
+ *
+ * vPortDefineHeapRegions( xHeapRegions ); << Pass the array into vPortDefineHeapRegions().
+ *
+ */
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The kernel calls functions that only heap_4.c and heap_5.c provide when
+these options are set to 1, so they cannot be used with this heap. */
+#if( configUSE_HEAP_SLABS == 1 )
+	#error configUSE_HEAP_SLABS can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+	#error configUSE_HEAP_ACCOUNTING can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_CANARIES == 1 )
+	#error configUSE_HEAP_CANARIES can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+	#error configUSE_HEAP_ISR_CACHE can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+/* pvPortMallocTCB() and pvPortMallocStack() use pvPortMallocFromClass() when
+configUSE_HEAP_REGION_CLASSES is 1, and only heap_5.c provides it. */
+#if( configUSE_HEAP_REGION_CLASSES == 1 )
+	#error configUSE_HEAP_REGION_CLASSES can only be set to 1 when heap_5.c is used
+#endif
+
+/* log2 of portBYTE_ALIGNMENT.  All block sizes are a multiple of
+portBYTE_ALIGNMENT, so the lowest bits of a size carry no information. */
+#if portBYTE_ALIGNMENT == 32
+	#define heapALIGNMENT_LOG2	5
+#elif portBYTE_ALIGNMENT == 16
+	#define heapALIGNMENT_LOG2	4
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGNMENT_LOG2	3
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGNMENT_LOG2	2
+#elif portBYTE_ALIGNMENT == 2
+	#define heapALIGNMENT_LOG2	1
+#elif portBYTE_ALIGNMENT == 1
+	#define heapALIGNMENT_LOG2	0
+#else
+	#error Invalid portBYTE_ALIGNMENT definition
+#endif
+
+/* Each first level size range is divided into this many second level lists. */
+#define heapSL_INDEX_COUNT_LOG2	( 3 )
+#define heapSL_INDEX_COUNT		( 1 << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE are all held in the lists of the
+first first level index, each of which then holds blocks of a single size.
+Larger blocks are indexed by the position of their most significant bit. */
+#define heapFL_INDEX_SHIFT		( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+#define heapFL_INDEX_COUNT		( configTLSF_MAX_BLOCK_SIZE_BITS - heapFL_INDEX_SHIFT + 1 )
+
+/* Every block, including its header, must be smaller than this. */
+#define heapMAX_BLOCK_SIZE		( ( size_t ) 1 << configTLSF_MAX_BLOCK_SIZE_BITS )
+
+#if( configTLSF_MAX_BLOCK_SIZE_BITS > 31 )
+	#error configTLSF_MAX_BLOCK_SIZE_BITS must not be greater than 31
+#endif
+
+#if( heapFL_INDEX_COUNT < 2 )
+	#error configTLSF_MAX_BLOCK_SIZE_BITS is too small for the byte alignment in use
+#endif
+
+/* Block sizes must not get too small - a free block must be able to hold the
+whole of its BlockLink_t structure. */
+#define heapMINIMUM_BLOCK_SIZE	( ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* Define the structure placed at the start of each block.  Only the first two
+members are kept while a block is allocated - the free list links overlay the
+start of the memory returned to the application. */
+typedef struct A_TLSF_BLOCK_LINK
+{
+	struct A_TLSF_BLOCK_LINK *pxPreviousPhysicalBlock;	/*<< The block immediately below this block in memory, or NULL if this is the first block in a region. */
+	size_t xBlockSize;									/*<< The size of the block, including this header.  The top bit is set while the block is allocated. */
+	struct A_TLSF_BLOCK_LINK *pxNextFreeBlock;			/*<< The next block in the same free list.  Only valid while the block is free. */
+	struct A_TLSF_BLOCK_LINK *pxPreviousFreeBlock;		/*<< The previous block in the same free list.  Only valid while the block is free. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the bit number of the most (prvFindLastSet()) or least
+ * (prvFindFirstSet()) significant bit set in ulValue, which must not be 0.
+ */
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+static UBaseType_t prvFindFirstSet( uint32_t ulValue );
+
+/*
+ * Calculate the first and second level indexes of the free list that holds
+ * blocks of xBlockSize bytes.
+ */
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Return a free block of at least xWantedSize bytes, or NULL if there is not
+ * one.  The size is rounded up to the start of the next second level range
+ * before it is mapped, so any block in the list found is large enough.
+ */
+static BlockLink_t *prvFindSuitableBlock( size_t xWantedSize );
+
+/*
+ * Add a free block to, or remove a free block from, the list that holds
+ * blocks of its size.
+ */
+static void prvInsertFreeBlock( BlockLink_t *pxBlock );
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock );
+
+/*
+ * Place a single free block followed by an end marker in xRegionSize bytes
+ * starting at the aligned address xAddress.  Returns the size of the free
+ * block.
+ */
+static size_t prvAddRegion( size_t xAddress, size_t xRegionSize );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the structure placed at the beginning of each
+allocated memory block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Bit n of ulFirstLevelBitmap is set when any list in row n of pxFreeLists is
+not empty.  Bit m of ulSecondLevelBitmap[ n ] is set when pxFreeLists[ n ][ m ]
+is not empty. */
+static uint32_t ulFirstLevelBitmap = 0UL;
+static uint32_t ulSecondLevelBitmap[ heapFL_INDEX_COUNT ] = { 0UL };
+static BlockLink_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ] = { { NULL } };
+
+/* Set once vPortDefineHeapRegions() has been called. */
+static BaseType_t xHeapDefined = pdFALSE;
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+member of an BlockLink_t structure is set then the block belongs to the
+application.  When the bit is free the block is still part of the free heap
+space. */
+static const size_t xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+/*-----------------------------------------------------------*/
+
+/* The block that follows pxBlock in memory.  The end marker of a region is
+allocated and zero sized, so is never merged with and never walked past. */
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock ) ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + ( ( pxBlock )->xBlockSize & ~xBlockAllocatedBit ) ) )
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+const size_t xRequestedSize = xWantedSize;
+
+	/* The heap must be initialised before the first call to
+	prvPortMalloc(). */
+	configASSERT( xHeapDefined );
+
+	vTaskSuspendAll();
+	{
+		/* Check the requested block size, once its header and any alignment
+		padding are added, will still be less than the largest block the
+		index can hold.  This also ensures the top bit is clear. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < ( heapMAX_BLOCK_SIZE - xHeapStructSize - portBYTE_ALIGNMENT ) ) )
+		{
+			/* The wanted size is increased so it can contain the BlockLink_t
+			header in addition to the requested amount of bytes. */
+			xWantedSize += xHeapStructSize;
+
+			/* Ensure that blocks are always aligned to the required number
+			of bytes. */
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				/* Byte alignment required. */
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The block must be able to hold the free list links once it is
+			freed again. */
+			if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+			{
+				xWantedSize = heapMINIMUM_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize <= xFreeBytesRemaining )
+			{
+				pxBlock = prvFindSuitableBlock( xWantedSize );
+
+				if( pxBlock != NULL )
+				{
+					/* This block is being returned for use so must be taken out
+					of the list of free blocks. */
+					prvRemoveFreeBlock( pxBlock );
+
+					/* If the block is larger than required it can be split into
+					two. */
+					if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+					{
+						/* This block is to be split into two.  Create a new
+						block following the number of bytes requested. The void
+						cast is used to prevent byte alignment warnings from the
+						compiler. */
+						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+
+						/* Calculate the sizes of two blocks split from the
+						single block, and link the new block into the physical
+						order of the blocks. */
+						pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+						pxNewBlockLink->pxPreviousPhysicalBlock = pxBlock;
+						heapNEXT_PHYSICAL_BLOCK( pxNewBlockLink )->pxPreviousPhysicalBlock = pxNewBlockLink;
+						pxBlock->xBlockSize = xWantedSize;
+
+						/* Insert the new block into the list of free blocks. */
+						prvInsertFreeBlock( pxNewBlockLink );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The block is being returned - it is allocated and owned
+					by the application. */
+					pxBlock->xBlockSize |= xBlockAllocatedBit;
+
+					/* Return the memory space pointed to - jumping over the
+					BlockLink_t header at its start. */
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+		traceMALLOC_REQUESTED( pvReturn, xRequestedSize );
+
+		/* Prevent compiler warnings when traceMALLOC_REQUESTED() is not
+		defined. */
+		( void ) xRequestedSize;
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a BlockLink_t header immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+
+		if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				/* The block is being returned to the heap - it is no longer
+				allocated.  This must not be done until the scheduler is
+				suspended, otherwise another task freeing a neighbouring block
+				could see this block as free and merge it before it is in the
+				free list. */
+				pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+				xFreeBytesRemaining += pxLink->xBlockSize;
+				traceFREE( pv, pxLink->xBlockSize );
+
+				/* Merge with the block above, if it is free. */
+				pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+				if( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxLink->xBlockSize += pxNeighbour->xBlockSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Merge with the block below, if it is free. */
+				pxNeighbour = pxLink->pxPreviousPhysicalBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxLink->xBlockSize;
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block above the merged block now follows a different
+				block. */
+				heapNEXT_PHYSICAL_BLOCK( pxLink )->pxPreviousPhysicalBlock = pxLink;
+
+				/* Add the merged block to the list of free blocks. */
+				prvInsertFreeBlock( pxLink );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+UBaseType_t uxBit;
+
+	#if defined( __GNUC__ )
+	{
+		uxBit = ( UBaseType_t ) ( 31 - __builtin_clz( ulValue ) );
+	}
+	#else
+	{
+		/* A binary search takes the same number of steps whatever the
+		value. */
+		uxBit = 0;
+
+		if( ( ulValue & 0xffff0000UL ) != 0UL )
+		{
+			ulValue >>= 16;
+			uxBit += 16;
+		}
+
+		if( ( ulValue & 0xff00UL ) != 0UL )
+		{
+			ulValue >>= 8;
+			uxBit += 8;
+		}
+
+		if( ( ulValue & 0xf0UL ) != 0UL )
+		{
+			ulValue >>= 4;
+			uxBit += 4;
+		}
+
+		if( ( ulValue & 0x0cUL ) != 0UL )
+		{
+			ulValue >>= 2;
+			uxBit += 2;
+		}
+
+		if( ( ulValue & 0x02UL ) != 0UL )
+		{
+			uxBit += 1;
+		}
+	}
+	#endif
+
+	return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulValue )
+{
+	/* Isolate the least significant set bit. */
+	return prvFindLastSet( ulValue & ( ~ulValue + 1UL ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+UBaseType_t uxFirstLevel;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are stored in lists that each hold one size. */
+		*puxFirstLevel = 0;
+		*puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The second level index is given by the heapSL_INDEX_COUNT_LOG2
+		bits below the most significant bit. */
+		uxFirstLevel = prvFindLastSet( ( uint32_t ) xBlockSize );
+		*puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> ( uxFirstLevel - heapSL_INDEX_COUNT_LOG2 ) ) ^ ( UBaseType_t ) heapSL_INDEX_COUNT;
+		*puxFirstLevel = uxFirstLevel - ( heapFL_INDEX_SHIFT - 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t *prvFindSuitableBlock( size_t xWantedSize )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+uint32_t ulBitmap;
+BlockLink_t *pxBlock = NULL;
+
+	/* Round the size up so the list it maps to only contains blocks that are
+	at least as large as the wanted size.  Small block lists hold a single size
+	so need no rounding. */
+	if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xWantedSize += ( ( ( size_t ) 1 ) << ( prvFindLastSet( ( uint32_t ) xWantedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMapBlockSize( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+
+	/* Rounding up may have taken the size beyond the largest size range. */
+	if( uxFirstLevel < ( UBaseType_t ) heapFL_INDEX_COUNT )
+	{
+		/* Look for a list in the same size range that holds blocks that are
+		the same size or larger. */
+		ulBitmap = ulSecondLevelBitmap[ uxFirstLevel ] & ( ~0UL << uxSecondLevel );
+
+		if( ulBitmap == 0UL )
+		{
+			/* There are none, so use the smallest blocks from the next size
+			range up that has any free blocks. */
+			ulBitmap = ulFirstLevelBitmap & ( ~0UL << ( uxFirstLevel + 1 ) );
+
+			if( ulBitmap != 0UL )
+			{
+				uxFirstLevel = prvFindFirstSet( ulBitmap );
+				ulBitmap = ulSecondLevelBitmap[ uxFirstLevel ];
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulBitmap != 0UL )
+		{
+			uxSecondLevel = prvFindFirstSet( ulBitmap );
+			pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMapBlockSize( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+	/* Add the block to the front of its list. */
+	pxBlock->pxPreviousFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock;
+
+	/* The list, and the size range that contains it, now hold a free block. */
+	ulFirstLevelBitmap |= ( 1UL << uxFirstLevel );
+	ulSecondLevelBitmap[ uxFirstLevel ] |= ( 1UL << uxSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMapBlockSize( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock->pxPreviousFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPreviousFreeBlock != NULL )
+	{
+		pxBlock->pxPreviousFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was at the front of its list. */
+		configASSERT( pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] == pxBlock );
+		pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			/* The list is now empty, as might be the whole size range. */
+			ulSecondLevelBitmap[ uxFirstLevel ] &= ~( 1UL << uxSecondLevel );
+
+			if( ulSecondLevelBitmap[ uxFirstLevel ] == 0UL )
+			{
+				ulFirstLevelBitmap &= ~( 1UL << uxFirstLevel );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvAddRegion( size_t xAddress, size_t xRegionSize )
+{
+BlockLink_t *pxFirstBlockInRegion, *pxEnd;
+size_t xBlockSize;
+
+	/* Leave space at the end of the region for the end marker. */
+	xBlockSize = ( xRegionSize - xHeapStructSize ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	/* To start with there is a single free block in the region. */
+	pxFirstBlockInRegion = ( BlockLink_t * ) xAddress;
+	pxFirstBlockInRegion->pxPreviousPhysicalBlock = NULL;
+	pxFirstBlockInRegion->xBlockSize = xBlockSize;
+
+	/* The end marker looks like a zero sized allocated block, so the free
+	block is never merged beyond the end of the region.  Only the header
+	members are written, so it only needs xHeapStructSize bytes. */
+	pxEnd = heapNEXT_PHYSICAL_BLOCK( pxFirstBlockInRegion );
+	pxEnd->pxPreviousPhysicalBlock = pxFirstBlockInRegion;
+	pxEnd->xBlockSize = xBlockAllocatedBit;
+
+	prvInsertFreeBlock( pxFirstBlockInRegion );
+
+	return xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+size_t xTotalRegionSize, xTotalHeapSize = 0, xChunkSize;
+BaseType_t xDefinedRegions = 0;
+size_t xAddress;
+const HeapRegion_t *pxHeapRegion;
+
+	/* Can only call once! */
+	configASSERT( xHeapDefined == pdFALSE );
+
+	pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+	while( pxHeapRegion->xSizeInBytes > 0 )
+	{
+		xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+		/* Ensure the heap region starts on a correctly aligned boundary. */
+		xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+		if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xAddress += ( portBYTE_ALIGNMENT - 1 );
+			xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+			/* Adjust the size for the bytes lost to alignment. */
+			xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+		}
+
+		/* A block cannot be as large as heapMAX_BLOCK_SIZE, so a larger
+		region is added in chunks that each end with their own end marker. */
+		while( xTotalRegionSize >= ( heapMINIMUM_BLOCK_SIZE + xHeapStructSize ) )
+		{
+			if( xTotalRegionSize >= heapMAX_BLOCK_SIZE )
+			{
+				xChunkSize = heapMAX_BLOCK_SIZE;
+			}
+			else
+			{
+				xChunkSize = xTotalRegionSize;
+			}
+
+			xTotalHeapSize += prvAddRegion( xAddress, xChunkSize );
+
+			xAddress += xChunkSize;
+			xTotalRegionSize -= xChunkSize;
+		}
+
+		/* Move onto the next HeapRegion_t structure. */
+		xDefinedRegions++;
+		pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+	}
+
+	xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+	xFreeBytesRemaining = xTotalHeapSize;
+
+	/* Check something was actually defined before it is accessed. */
+	configASSERT( xTotalHeapSize );
+
+	xHeapDefined = pdTRUE;
+}
+
@@ -0,0 +1,772 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that keeps free
+ * blocks in segregated lists (bins) by size, chooses the best fitting free
+ * block for each allocation, and combines (coalesces) adjacent free blocks as
+ * soon as they are freed.
+ *
+ * heap_2.c also uses best fit but never combines adjacent blocks, and heap_4.c
+ * combines adjacent blocks but uses first fit on a list ordered by address, so
+ * the small blocks left at the start of the list have to be walked past by
+ * every allocation.  Here blocks smaller than heapSMALL_BLOCK_SIZE are held in
+ * bins that each hold blocks of a single size, and larger blocks are held in
+ * bins that each cover a power of two range of sizes.  A bitmap records which
+ * bins are not empty, so the bins that cannot hold a large enough block are
+ * skipped without being searched.  Only the bin that holds a best fit has to
+ * be walked, and only when it covers a range of sizes.
+ *
+ * Each block starts with a header that holds its size, and each free block
+ * also ends with a copy of its size (a boundary tag).  The header records
+ * whether the block before it in memory is free, in which case the boundary
+ * tag just below the header gives the start of that block.  A block being
+ * freed can therefore be combined with both of its neighbours without
+ * searching for them.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c, heap_5.c and heap_6.c for
+ * alternative implementations, and the memory management pages of
+ * http://www.FreeRTOS.org for more information.
+ */
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The kernel calls functions that only heap_4.c and heap_5.c provide when
+these options are set to 1, so they cannot be used with this heap. */
+#if( configUSE_HEAP_SLABS == 1 )
+	#error configUSE_HEAP_SLABS can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ACCOUNTING == 1 )
+	#error configUSE_HEAP_ACCOUNTING can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_CANARIES == 1 )
+	#error configUSE_HEAP_CANARIES can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+#if( configUSE_HEAP_ISR_CACHE == 1 )
+	#error configUSE_HEAP_ISR_CACHE can only be set to 1 when heap_4.c or heap_5.c is used
+#endif
+
+/* pvPortMallocTCB() and pvPortMallocStack() use pvPortMallocFromClass() when
+configUSE_HEAP_REGION_CLASSES is 1, and only heap_5.c provides it. */
+#if( configUSE_HEAP_REGION_CLASSES == 1 )
+	#error configUSE_HEAP_REGION_CLASSES can only be set to 1 when heap_5.c is used
+#endif
+
+/* log2 of portBYTE_ALIGNMENT.  All block sizes are a multiple of
+portBYTE_ALIGNMENT, so the lowest bits of a size carry no information. */
+#if portBYTE_ALIGNMENT == 32
+	#define heapALIGNMENT_LOG2	5
+#elif portBYTE_ALIGNMENT == 16
+	#define heapALIGNMENT_LOG2	4
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGNMENT_LOG2	3
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGNMENT_LOG2	2
+#elif portBYTE_ALIGNMENT == 2
+	#define heapALIGNMENT_LOG2	1
+#elif portBYTE_ALIGNMENT == 1
+	#define heapALIGNMENT_LOG2	0
+#else
+	#error Invalid portBYTE_ALIGNMENT definition
+#endif
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE are held in the first
+heapNUM_EXACT_BINS bins, each of which holds blocks of a single size.  Larger
+blocks are held in the following heapNUM_RANGE_BINS bins, each of which holds
+blocks whose sizes have the same most significant bit.  There are never more
+than 32 bins of either kind, so each kind has a single 32-bit bitmap. */
+#define heapNUM_EXACT_BINS			( 32 )
+#define heapSMALL_BLOCK_SIZE_LOG2	( 5 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE		( ( size_t ) 1 << heapSMALL_BLOCK_SIZE_LOG2 )
+#define heapNUM_RANGE_BINS			( 32 - heapSMALL_BLOCK_SIZE_LOG2 )
+#define heapNUM_BINS				( heapNUM_EXACT_BINS + heapNUM_RANGE_BINS )
+
+/* Block sizes must not get too small - a free block must be able to hold the
+whole of its BlockLink_t structure and its boundary tag. */
+#define heapMINIMUM_BLOCK_SIZE	( ( sizeof( BlockLink_t ) + sizeof( size_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* Allocate the memory for the heap. */
+#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Define the structure placed at the start of each block.  Only the first
+member is kept while a block is allocated - the free list links overlay the
+start of the memory returned to the application. */
+typedef struct A_BLOCK_LINK
+{
+	size_t xBlockSize;							/*<< The size of the block, including this header.  The top two bits are xBlockAllocatedBit and xPreviousBlockFreeBit. */
+	struct A_BLOCK_LINK *pxNextFreeBlock;		/*<< The next block in the same bin.  Only valid while the block is free. */
+	struct A_BLOCK_LINK *pxPreviousFreeBlock;	/*<< The previous block in the same bin.  Only valid while the block is free. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+
+/*
+ * Return the bit number of the most (prvFindLastSet()) or least
+ * (prvFindFirstSet()) significant bit set in ulValue, which must not be 0.
+ */
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+static UBaseType_t prvFindFirstSet( uint32_t ulValue );
+
+/*
+ * Return the index of the bin that holds free blocks of xBlockSize bytes.
+ */
+static UBaseType_t prvBinIndex( size_t xBlockSize );
+
+/*
+ * Return the smallest free block that is at least xWantedSize bytes, or NULL
+ * if there is not one.
+ */
+static BlockLink_t *prvFindBestFit( size_t xWantedSize );
+
+/*
+ * Add a free block to, or remove a free block from, the bin that holds blocks
+ * of its size.  Adding a block also writes its boundary tag and marks the
+ * block that follows it as following a free block.
+ */
+static void prvInsertFreeBlock( BlockLink_t *pxBlock );
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the structure placed at the beginning of each
+allocated memory block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The space reserved for the end marker.  Only its xBlockSize member is used,
+but it is accessed through a BlockLink_t pointer, so room is left for a whole
+structure. */
+static const size_t xEndMarkerSize	= ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The bins, and the bitmaps that record which of them are not empty.  Bit n of
+ulExactBinBitmap is set when pxBins[ n ] is not empty, and bit n of
+ulRangeBinBitmap is set when pxBins[ heapNUM_EXACT_BINS + n ] is not empty. */
+static BlockLink_t *pxBins[ heapNUM_BINS ] = { NULL };
+static uint32_t ulExactBinBitmap = 0UL;
+static uint32_t ulRangeBinBitmap = 0UL;
+
+/* Set once the heap has been initialised. */
+static BaseType_t xHeapInitialised = pdFALSE;
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+member of an BlockLink_t structure is set then the block belongs to the
+application.  When the bit is free the block is still part of the free heap
+space.  The bit below it is set when the block immediately below the block in
+memory is free, and so ends with a boundary tag. */
+static const size_t xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+static const size_t xPreviousBlockFreeBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 2 );
+
+/*-----------------------------------------------------------*/
+
+/* The size of pxBlock without the flag bits. */
+#define heapBLOCK_SIZE( pxBlock ) ( ( pxBlock )->xBlockSize & ~( xBlockAllocatedBit | xPreviousBlockFreeBit ) )
+
+/* The block that follows pxBlock in memory.  The end marker is allocated and
+zero sized, so is never merged with and never walked past. */
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock ) ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/* The boundary tag held in the last bytes of the free block pxBlock. */
+#define heapBOUNDARY_TAG( pxBlock ) ( *( size_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) - sizeof( size_t ) ) )
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+const size_t xRequestedSize = xWantedSize;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the bins. */
+		if( xHeapInitialised == pdFALSE )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Check the requested block size, once its header and any alignment
+		padding are added, will not be so large that it uses either of the
+		flag bits. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < ( xPreviousBlockFreeBit - xHeapStructSize - portBYTE_ALIGNMENT ) ) )
+		{
+			/* The wanted size is increased so it can contain the BlockLink_t
+			header in addition to the requested amount of bytes. */
+			xWantedSize += xHeapStructSize;
+
+			/* Ensure that blocks are always aligned to the required number
+			of bytes. */
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				/* Byte alignment required. */
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The block must be able to hold the free list links and the
+			boundary tag once it is freed again. */
+			if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+			{
+				xWantedSize = heapMINIMUM_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize <= xFreeBytesRemaining )
+			{
+				pxBlock = prvFindBestFit( xWantedSize );
+
+				if( pxBlock != NULL )
+				{
+					/* This block is being returned for use so must be taken out
+					of its bin. */
+					prvRemoveFreeBlock( pxBlock );
+
+					/* If the block is larger than required it can be split into
+					two. */
+					if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+					{
+						/* This block is to be split into two.  Create a new
+						block following the number of bytes requested. The void
+						cast is used to prevent byte alignment warnings from the
+						compiler.  The new block follows an allocated block so
+						has no flag bits set. */
+						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+						pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+						pxBlock->xBlockSize = xWantedSize;
+
+						/* Insert the new block into its bin. */
+						prvInsertFreeBlock( pxNewBlockLink );
+					}
+					else
+					{
+						/* The whole block is used, so the block above no longer
+						follows a free block. */
+						heapNEXT_PHYSICAL_BLOCK( pxBlock )->xBlockSize &= ~xPreviousBlockFreeBit;
+					}
+
+					xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The block is being returned - it is allocated and owned
+					by the application.  Free blocks never follow free blocks,
+					so xPreviousBlockFreeBit is already clear. */
+					pxBlock->xBlockSize |= xBlockAllocatedBit;
+
+					/* Return the memory space pointed to - jumping over the
+					BlockLink_t header at its start. */
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+		traceMALLOC_REQUESTED( pvReturn, xRequestedSize );
+
+		/* Prevent compiler warnings when traceMALLOC_REQUESTED() is not
+		defined. */
+		( void ) xRequestedSize;
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxNeighbour;
+size_t xBlockSize;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a BlockLink_t header immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+
+		if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				xBlockSize = heapBLOCK_SIZE( pxLink );
+				xFreeBytesRemaining += xBlockSize;
+				traceFREE( pv, xBlockSize );
+
+				/* Merge with the block above, if it is free. */
+				pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+				if( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					xBlockSize += heapBLOCK_SIZE( pxNeighbour );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Merge with the block below, if it is free.  Its boundary tag
+				is immediately below this block's header. */
+				if( ( pxLink->xBlockSize & xPreviousBlockFreeBit ) != 0 )
+				{
+					pxNeighbour = ( BlockLink_t * ) ( puc - *( ( size_t * ) ( puc - sizeof( size_t ) ) ) );
+					prvRemoveFreeBlock( pxNeighbour );
+					xBlockSize += heapBLOCK_SIZE( pxNeighbour );
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block is being returned to the heap - it is no longer
+				allocated, and can not follow a free block. */
+				pxLink->xBlockSize = xBlockSize;
+				prvInsertFreeBlock( pxLink );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+BlockLink_t *pxFirstFreeBlock, *pxEnd;
+size_t uxAddress;
+size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+	/* Ensure the heap starts on a correctly aligned boundary. */
+	uxAddress = ( size_t ) ucHeap;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - 1 );
+		uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= uxAddress - ( size_t ) ucHeap;
+	}
+
+	/* To start with there is a single free block that is sized to take up the
+	entire heap space, minus the space taken by the end marker.  Nothing is
+	below it, so it does not follow a free block. */
+	pxFirstFreeBlock = ( void * ) uxAddress;
+	pxFirstFreeBlock->xBlockSize = ( xTotalHeapSize - xEndMarkerSize ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	/* The end marker looks like a zero sized allocated block, so the free
+	block is never merged beyond the end of the heap.  prvInsertFreeBlock()
+	marks it as following a free block. */
+	pxEnd = heapNEXT_PHYSICAL_BLOCK( pxFirstFreeBlock );
+	pxEnd->xBlockSize = xBlockAllocatedBit;
+
+	prvInsertFreeBlock( pxFirstFreeBlock );
+
+	/* Only one block exists - and it covers the entire usable heap space. */
+	xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+	xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+
+	xHeapInitialised = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+UBaseType_t uxBit;
+
+	#if defined( __GNUC__ )
+	{
+		uxBit = ( UBaseType_t ) ( 31 - __builtin_clz( ulValue ) );
+	}
+	#else
+	{
+		/* A binary search takes the same number of steps whatever the
+		value. */
+		uxBit = 0;
+
+		if( ( ulValue & 0xffff0000UL ) != 0UL )
+		{
+			ulValue >>= 16;
+			uxBit += 16;
+		}
+
+		if( ( ulValue & 0xff00UL ) != 0UL )
+		{
+			ulValue >>= 8;
+			uxBit += 8;
+		}
+
+		if( ( ulValue & 0xf0UL ) != 0UL )
+		{
+			ulValue >>= 4;
+			uxBit += 4;
+		}
+
+		if( ( ulValue & 0x0cUL ) != 0UL )
+		{
+			ulValue >>= 2;
+			uxBit += 2;
+		}
+
+		if( ( ulValue & 0x02UL ) != 0UL )
+		{
+			uxBit += 1;
+		}
+	}
+	#endif
+
+	return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulValue )
+{
+	/* Isolate the least significant set bit. */
+	return prvFindLastSet( ulValue & ( ~ulValue + 1UL ) );
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvBinIndex( size_t xBlockSize )
+{
+UBaseType_t uxBin;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		uxBin = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The heap is smaller than 4GB so the size fits in 32 bits. */
+		uxBin = ( UBaseType_t ) heapNUM_EXACT_BINS + ( prvFindLastSet( ( uint32_t ) xBlockSize ) - ( UBaseType_t ) heapSMALL_BLOCK_SIZE_LOG2 );
+	}
+
+	return uxBin;
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t *prvFindBestFit( size_t xWantedSize )
+{
+BlockLink_t *pxBlock = NULL, *pxIterator;
+UBaseType_t uxBin, uxRangeBin;
+uint32_t ulBitmap;
+
+	uxBin = prvBinIndex( xWantedSize );
+
+	if( uxBin < ( UBaseType_t ) heapNUM_EXACT_BINS )
+	{
+		/* Every block in the smallest non-empty exact bin at or above the
+		wanted size is a best fit. */
+		ulBitmap = ulExactBinBitmap & ( ~0UL << uxBin );
+
+		if( ulBitmap != 0UL )
+		{
+			pxBlock = pxBins[ prvFindFirstSet( ulBitmap ) ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxRangeBin = 0;
+	}
+	else
+	{
+		/* The bin that covers the wanted size can hold blocks that are
+		smaller than it, so has to be searched. */
+		for( pxIterator = pxBins[ uxBin ]; pxIterator != NULL; pxIterator = pxIterator->pxNextFreeBlock )
+		{
+			if( ( pxIterator->xBlockSize >= xWantedSize ) && ( ( pxBlock == NULL ) || ( pxIterator->xBlockSize < pxBlock->xBlockSize ) ) )
+			{
+				pxBlock = pxIterator;
+
+				if( pxBlock->xBlockSize == xWantedSize )
+				{
+					/* Cannot do better than an exact fit. */
+					break;
+				}
+			}
+		}
+
+		uxRangeBin = ( uxBin - ( UBaseType_t ) heapNUM_EXACT_BINS ) + 1;
+	}
+
+	if( ( pxBlock == NULL ) && ( uxRangeBin < ( UBaseType_t ) heapNUM_RANGE_BINS ) )
+	{
+		/* Every block in any higher bin is large enough, so the best fit is
+		the smallest block in the lowest non-empty higher bin. */
+		ulBitmap = ulRangeBinBitmap & ( ~0UL << uxRangeBin );
+
+		if( ulBitmap != 0UL )
+		{
+			pxBlock = pxBins[ heapNUM_EXACT_BINS + prvFindFirstSet( ulBitmap ) ];
+
+			for( pxIterator = pxBlock->pxNextFreeBlock; pxIterator != NULL; pxIterator = pxIterator->pxNextFreeBlock )
+			{
+				if( pxIterator->xBlockSize < pxBlock->xBlockSize )
+				{
+					pxBlock = pxIterator;
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxBin;
+
+	/* Write the boundary tag so the block can be found from the block above
+	it, and tell the block above that it follows a free block. */
+	heapBOUNDARY_TAG( pxBlock ) = pxBlock->xBlockSize;
+	heapNEXT_PHYSICAL_BLOCK( pxBlock )->xBlockSize |= xPreviousBlockFreeBit;
+
+	/* Add the block to the front of its bin. */
+	uxBin = prvBinIndex( pxBlock->xBlockSize );
+	pxBlock->pxPreviousFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxBins[ uxBin ];
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxBins[ uxBin ] = pxBlock;
+
+	if( uxBin < ( UBaseType_t ) heapNUM_EXACT_BINS )
+	{
+		ulExactBinBitmap |= ( 1UL << uxBin );
+	}
+	else
+	{
+		ulRangeBinBitmap |= ( 1UL << ( uxBin - ( UBaseType_t ) heapNUM_EXACT_BINS ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxBin;
+
+	uxBin = prvBinIndex( pxBlock->xBlockSize );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock->pxPreviousFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPreviousFreeBlock != NULL )
+	{
+		pxBlock->pxPreviousFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was at the front of its bin. */
+		configASSERT( pxBins[ uxBin ] == pxBlock );
+		pxBins[ uxBin ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			/* The bin is now empty. */
+			if( uxBin < ( UBaseType_t ) heapNUM_EXACT_BINS )
+			{
+				ulExactBinBitmap &= ~( 1UL << uxBin );
+			}
+			else
+			{
+				ulRangeBinBitmap &= ~( 1UL << ( uxBin - ( UBaseType_t ) heapNUM_EXACT_BINS ) );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+
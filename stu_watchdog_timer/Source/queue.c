@@ -156,6 +156,11 @@ typedef struct QueueDefinition
 
 	#if ( configUSE_QUEUE_SETS == 1 )
 		struct QueueDefinition *pxQueueSetContainer;
+		volatile BaseType_t xQueueSetPending;	/*< Set to pdTRUE while the handle of this queue is held in the queue set, so the set never holds more than one entry per member. */
+	#endif
+
+	#if ( configUSE_QUEUE_STATS == 1 )
+		QueueStats_t xStats;
 	#endif
 
 } xQUEUE;
@@ -193,6 +198,70 @@ typedef xQUEUE Queue_t;
 
 #endif /* configQUEUE_REGISTRY_SIZE */
 
+/*
+ * Macros that maintain the optional queue statistics.  They are placed
+ * alongside the trace macros of the same name.  The counters that can be
+ * updated from an interrupt are only updated from within a critical section,
+ * so the macros add no locking of their own except on the path taken when a
+ * blocked task times out, which is outside of any critical section.
+ */
+#if ( configUSE_QUEUE_STATS == 1 )
+
+	#define queueSTATS_RECORD_PEAK( pxQueue )												\
+		do																					\
+		{																					\
+			if( ( pxQueue )->uxMessagesWaiting > ( pxQueue )->xStats.uxPeakMessagesWaiting )	\
+			{																				\
+				( pxQueue )->xStats.uxPeakMessagesWaiting = ( pxQueue )->uxMessagesWaiting;	\
+			}																				\
+		} while( 0 )
+
+	#define queueSTATS_INCREMENT( pxQueue, ulCounter )	( ( pxQueue )->xStats.ulCounter )++
+
+	/* Count each call that blocks once, no matter how many times the task
+	re-enters the Blocked state before the call returns, and remember when the
+	call first blocked. */
+	#define queueSTATS_RECORD_BLOCK( pxQueue, ulCounter, xBlocked, xBlockTime )	\
+		do																			\
+		{																			\
+			if( ( xBlocked ) == pdFALSE )											\
+			{																		\
+				( xBlocked ) = pdTRUE;												\
+				( xBlockTime ) = xTaskGetTickCount();								\
+				( ( pxQueue )->xStats.ulCounter )++;								\
+			}																		\
+		} while( 0 )
+
+	#define queueSTATS_RECORD_WAIT( pxQueue, ulHistogram, xBlocked, xBlockTime )			\
+		do																					\
+		{																					\
+			if( ( xBlocked ) != pdFALSE )													\
+			{																				\
+				prvRecordWaitTime( ( pxQueue )->xStats.ulHistogram, xTaskGetTickCount() - ( xBlockTime ) );	\
+			}																				\
+		} while( 0 )
+
+	#define queueSTATS_RECORD_TIMEOUT( pxQueue, ulCounter, ulHistogram, xBlocked, xBlockTime )	\
+		do																						\
+		{																						\
+			taskENTER_CRITICAL();																\
+			{																					\
+				queueSTATS_INCREMENT( ( pxQueue ), ulCounter );								\
+				queueSTATS_RECORD_WAIT( ( pxQueue ), ulHistogram, ( xBlocked ), ( xBlockTime ) );	\
+			}																					\
+			taskEXIT_CRITICAL();																\
+		} while( 0 )
+
+#else
+
+	#define queueSTATS_RECORD_PEAK( pxQueue )
+	#define queueSTATS_INCREMENT( pxQueue, ulCounter )
+	#define queueSTATS_RECORD_BLOCK( pxQueue, ulCounter, xBlocked, xBlockTime )
+	#define queueSTATS_RECORD_WAIT( pxQueue, ulHistogram, xBlocked, xBlockTime )
+	#define queueSTATS_RECORD_TIMEOUT( pxQueue, ulCounter, ulHistogram, xBlocked, xBlockTime )
+
+#endif /* configUSE_QUEUE_STATS */
+
 /*
  * Unlocks a queue locked by a call to prvLockQueue.  Locking a queue does not
  * prevent an ISR from adding or removing items to the queue, but does prevent
@@ -228,12 +297,21 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_QUEUE_STATS == 1 )
+	/*
+	 * Adds a wait of xWaitTime ticks to a log2 bucketed wait time histogram.
+	 */
+	static void prvRecordWaitTime( uint32_t * const pulHistogram, TickType_t xWaitTime ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
-	 * the queue set that the queue contains data.
+	 * the queue set that the queue contains data.  A queue is only notified to
+	 * its set once - further notifications are suppressed until the handle has
+	 * been returned by xQueueSelectFromSet().
 	 */
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvNotifyQueueSetContainer( Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
 #endif
 
 /*-----------------------------------------------------------*/
@@ -369,9 +447,16 @@ QueueHandle_t xReturn = NULL;
 		#if( configUSE_QUEUE_SETS == 1 )
 		{
 			pxNewQueue->pxQueueSetContainer = NULL;
+			pxNewQueue->xQueueSetPending = pdFALSE;
 		}
 		#endif /* configUSE_QUEUE_SETS */
 
+		#if( configUSE_QUEUE_STATS == 1 )
+		{
+			( void ) memset( ( void * ) &( pxNewQueue->xStats ), 0x00, sizeof( QueueStats_t ) );
+		}
+		#endif /* configUSE_QUEUE_STATS */
+
 		traceQUEUE_CREATE( pxNewQueue );
 		xReturn = pxNewQueue;
 	}
@@ -427,6 +512,13 @@ QueueHandle_t xReturn = NULL;
 			#if ( configUSE_QUEUE_SETS == 1 )
 			{
 				pxNewQueue->pxQueueSetContainer = NULL;
+				pxNewQueue->xQueueSetPending = pdFALSE;
+			}
+			#endif
+
+			#if ( configUSE_QUEUE_STATS == 1 )
+			{
+				( void ) memset( ( void * ) &( pxNewQueue->xStats ), 0x00, sizeof( QueueStats_t ) );
 			}
 			#endif
 
@@ -611,6 +703,10 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQ
 BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
 TimeOut_t xTimeOut;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if ( configUSE_QUEUE_STATS == 1 )
+	BaseType_t xBlocked = pdFALSE;
+	TickType_t xBlockTime = 0;
+#endif
 
 	configASSERT( pxQueue );
 	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
@@ -721,6 +817,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				#endif /* configUSE_QUEUE_SETS */
 
+				queueSTATS_RECORD_WAIT( pxQueue, ulSendWaitHistogram, xBlocked, xBlockTime );
 				taskEXIT_CRITICAL();
 				return pdPASS;
 			}
@@ -730,6 +827,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					/* The queue was full and no block time is specified (or
 					the block time has expired) so leave now. */
+					queueSTATS_INCREMENT( pxQueue, ulSendFailures );
+					queueSTATS_RECORD_WAIT( pxQueue, ulSendWaitHistogram, xBlocked, xBlockTime );
 					taskEXIT_CRITICAL();
 
 					/* Return to the original privilege level before exiting
@@ -765,6 +864,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			if( prvIsQueueFull( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				queueSTATS_RECORD_BLOCK( pxQueue, ulBlockedSends, xBlocked, xBlockTime );
 				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 
 				/* Unlocking the queue means queue events can effect the
@@ -797,6 +897,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
 
+			queueSTATS_RECORD_TIMEOUT( pxQueue, ulSendFailures, ulSendWaitHistogram, xBlocked, xBlockTime );
+
 			/* Return to the original privilege level before exiting the
 			function. */
 			traceQUEUE_SEND_FAILED( pxQueue );
@@ -813,6 +915,10 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	BaseType_t xEntryTimeSet = pdFALSE;
 	TimeOut_t xTimeOut;
 	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	#if ( configUSE_QUEUE_STATS == 1 )
+		BaseType_t xBlocked = pdFALSE;
+		TickType_t xBlockTime = 0;
+	#endif
 
 		configASSERT( pxQueue );
 		configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
@@ -828,6 +934,23 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					traceQUEUE_SEND( pxQueue );
 					prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
+					#if ( configUSE_QUEUE_SETS == 1 )
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						/* Tasks wait on the set rather than on its members.
+						The set is only notified if it does not already hold
+						the handle of this queue. */
+						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) == pdTRUE )
+						{
+							portYIELD_WITHIN_API();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					#endif /* configUSE_QUEUE_SETS */
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
 					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
@@ -848,6 +971,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 						mtCOVERAGE_TEST_MARKER();
 					}
 
+					queueSTATS_RECORD_WAIT( pxQueue, ulSendWaitHistogram, xBlocked, xBlockTime );
 					taskEXIT_CRITICAL();
 					return pdPASS;
 				}
@@ -855,6 +979,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( xTicksToWait == ( TickType_t ) 0 )
 					{
+						queueSTATS_INCREMENT( pxQueue, ulSendFailures );
+						queueSTATS_RECORD_WAIT( pxQueue, ulSendWaitHistogram, xBlocked, xBlockTime );
 						taskEXIT_CRITICAL();
 						return errQUEUE_FULL;
 					}
@@ -874,6 +1000,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					if( prvIsQueueFull( pxQueue ) != pdFALSE )
 					{
 						traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+						queueSTATS_RECORD_BLOCK( pxQueue, ulBlockedSends, xBlocked, xBlockTime );
 						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 						portYIELD_WITHIN_API();
 					}
@@ -884,6 +1011,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				else
 				{
+					queueSTATS_INCREMENT( pxQueue, ulSendFailures );
+					queueSTATS_RECORD_WAIT( pxQueue, ulSendWaitHistogram, xBlocked, xBlockTime );
 					taskEXIT_CRITICAL();
 					traceQUEUE_SEND_FAILED( pxQueue );
 					return errQUEUE_FULL;
@@ -904,6 +1033,10 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	TimeOut_t xTimeOut;
 	int8_t *pcOriginalReadPosition;
 	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	#if ( configUSE_QUEUE_STATS == 1 )
+		BaseType_t xBlocked = pdFALSE;
+		TickType_t xBlockTime = 0;
+	#endif
 
 		configASSERT( pxQueue );
 		configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
@@ -941,6 +1074,29 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 						}
 						#endif
 
+						#if ( configUSE_QUEUE_SETS == 1 )
+						{
+							/* The queue set holds at most one entry per member,
+							so if items remain after this read the member must
+							be notified to the set again. */
+							if( ( pxQueue->pxQueueSetContainer != NULL ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) )
+							{
+								if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) == pdTRUE )
+								{
+									portYIELD_WITHIN_API();
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_QUEUE_SETS */
+
 						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) == pdTRUE )
@@ -983,6 +1139,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 						}
 					}
 
+					queueSTATS_RECORD_WAIT( pxQueue, ulReceiveWaitHistogram, xBlocked, xBlockTime );
 					taskEXIT_CRITICAL();
 					return pdPASS;
 				}
@@ -990,6 +1147,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( xTicksToWait == ( TickType_t ) 0 )
 					{
+						queueSTATS_INCREMENT( pxQueue, ulReceiveFailures );
+						queueSTATS_RECORD_WAIT( pxQueue, ulReceiveWaitHistogram, xBlocked, xBlockTime );
 						taskEXIT_CRITICAL();
 						traceQUEUE_RECEIVE_FAILED( pxQueue );
 						return errQUEUE_EMPTY;
@@ -1010,6 +1169,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 					{
 						traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+						queueSTATS_RECORD_BLOCK( pxQueue, ulBlockedReceives, xBlocked, xBlockTime );
 
 						#if ( configUSE_MUTEXES == 1 )
 						{
@@ -1038,6 +1198,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				else
 				{
+					queueSTATS_INCREMENT( pxQueue, ulReceiveFailures );
+					queueSTATS_RECORD_WAIT( pxQueue, ulReceiveWaitHistogram, xBlocked, xBlockTime );
 					taskEXIT_CRITICAL();
 					traceQUEUE_RECEIVE_FAILED( pxQueue );
 					return errQUEUE_EMPTY;
@@ -1191,6 +1353,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		else
 		{
 			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			queueSTATS_INCREMENT( pxQueue, ulSendFailures );
 			xReturn = errQUEUE_FULL;
 		}
 	}
@@ -1255,6 +1418,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			priority disinheritance is needed.  Simply increase the count of
 			messages (semaphores) available. */
 			++( pxQueue->uxMessagesWaiting );
+			queueSTATS_RECORD_PEAK( pxQueue );
 
 			/* The event list is not altered if the queue is locked.  This will
 			be done when the queue is unlocked later. */
@@ -1352,6 +1516,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		else
 		{
 			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			queueSTATS_INCREMENT( pxQueue, ulSendFailures );
 			xReturn = errQUEUE_FULL;
 		}
 	}
@@ -1367,6 +1532,10 @@ BaseType_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
 int8_t *pcOriginalReadPosition;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if ( configUSE_QUEUE_STATS == 1 )
+	BaseType_t xBlocked = pdFALSE;
+	TickType_t xBlockTime = 0;
+#endif
 
 	configASSERT( pxQueue );
 	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
@@ -1416,6 +1585,29 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					}
 					#endif /* configUSE_MUTEXES */
 
+					#if ( configUSE_QUEUE_SETS == 1 )
+					{
+						/* The queue set holds at most one entry per member, so
+						if items remain after this read the member must be
+						notified to the set again. */
+						if( ( pxQueue->pxQueueSetContainer != NULL ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) )
+						{
+							if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) == pdTRUE )
+							{
+								queueYIELD_IF_USING_PREEMPTION();
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_QUEUE_SETS */
+
 					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) == pdTRUE )
@@ -1460,6 +1652,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					}
 				}
 
+				queueSTATS_RECORD_WAIT( pxQueue, ulReceiveWaitHistogram, xBlocked, xBlockTime );
 				taskEXIT_CRITICAL();
 				return pdPASS;
 			}
@@ -1469,6 +1662,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					/* The queue was empty and no block time is specified (or
 					the block time has expired) so leave now. */
+					queueSTATS_INCREMENT( pxQueue, ulReceiveFailures );
+					queueSTATS_RECORD_WAIT( pxQueue, ulReceiveWaitHistogram, xBlocked, xBlockTime );
 					taskEXIT_CRITICAL();
 					traceQUEUE_RECEIVE_FAILED( pxQueue );
 					return errQUEUE_EMPTY;
@@ -1501,6 +1696,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				queueSTATS_RECORD_BLOCK( pxQueue, ulBlockedReceives, xBlocked, xBlockTime );
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
@@ -1541,6 +1737,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
+			queueSTATS_RECORD_TIMEOUT( pxQueue, ulReceiveFailures, ulReceiveWaitHistogram, xBlocked, xBlockTime );
 			traceQUEUE_RECEIVE_FAILED( pxQueue );
 			return errQUEUE_EMPTY;
 		}
@@ -1583,6 +1780,36 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			prvCopyDataFromQueue( pxQueue, pvBuffer );
 			--( pxQueue->uxMessagesWaiting );
 
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				/* The queue set holds at most one entry per member, so if
+				items remain after this read the member must be notified to
+				the set again. */
+				if( ( pxQueue->pxQueueSetContainer != NULL ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) )
+				{
+					if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) == pdTRUE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_QUEUE_SETS */
+
 			/* If the queue is locked the event list will not be modified.
 			Instead update the lock count so the task that unlocks the queue
 			will know that an ISR has removed data while the queue was
@@ -1627,6 +1854,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			xReturn = pdFAIL;
 			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			queueSTATS_INCREMENT( pxQueue, ulReceiveFailures );
 		}
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
@@ -1681,6 +1909,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			xReturn = pdFAIL;
 			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+			queueSTATS_INCREMENT( pxQueue, ulReceiveFailures );
 		}
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
@@ -1850,6 +2079,7 @@ BaseType_t xReturn = pdFALSE;
 	}
 
 	++( pxQueue->uxMessagesWaiting );
+	queueSTATS_RECORD_PEAK( pxQueue );
 
 	return xReturn;
 }
@@ -2397,6 +2627,117 @@ BaseType_t xReturn;
 #endif /* configQUEUE_REGISTRY_SIZE */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_STATS == 1 )
+
+	void vQueueGetStats( QueueHandle_t xQueue, QueueStats_t *pxStats )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pxStats );
+
+		/* Take a consistent snapshot of the counters. */
+		taskENTER_CRITICAL();
+		{
+			*pxStats = pxQueue->xStats;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_QUEUE_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_STATS == 1 )
+
+	void vQueueResetStats( QueueHandle_t xQueue )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			( void ) memset( ( void * ) &( pxQueue->xStats ), 0x00, sizeof( QueueStats_t ) );
+
+			/* The peak starts from the current occupancy, not zero. */
+			pxQueue->xStats.uxPeakMessagesWaiting = pxQueue->uxMessagesWaiting;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_QUEUE_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_QUEUE_STATS == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) )
+
+	BaseType_t xQueueGetRegistryStats( UBaseType_t uxIndex, const char **ppcQueueName, QueueStats_t *pxStats ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	BaseType_t xReturn = pdFAIL;
+	QueueHandle_t xHandle = NULL;
+	const char *pcQueueName = NULL; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+		if( uxIndex < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE )
+		{
+			/* A NULL name denotes a free slot.  The slot is read from within a
+			critical section so the name and handle are read as a pair. */
+			taskENTER_CRITICAL();
+			{
+				pcQueueName = xQueueRegistry[ uxIndex ].pcQueueName;
+				xHandle = xQueueRegistry[ uxIndex ].xHandle;
+			}
+			taskEXIT_CRITICAL();
+
+			if( pcQueueName != NULL )
+			{
+				if( ppcQueueName != NULL )
+				{
+					*ppcQueueName = pcQueueName;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				vQueueGetStats( xHandle, pxStats );
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_QUEUE_STATS == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_STATS == 1 )
+
+	static void prvRecordWaitTime( uint32_t * const pulHistogram, TickType_t xWaitTime )
+	{
+	UBaseType_t uxBucket = ( UBaseType_t ) 0U;
+
+		/* Bucket 0 counts waits of less than one tick, and bucket n counts
+		waits of between 2^(n-1) and (2^n)-1 ticks.  The last bucket also counts
+		every wait that is longer still. */
+		while( ( xWaitTime != ( TickType_t ) 0 ) && ( uxBucket < ( UBaseType_t ) ( configQUEUE_STATS_WAIT_BUCKETS - 1 ) ) )
+		{
+			xWaitTime >>= 1;
+			uxBucket++;
+		}
+
+		( pulHistogram[ uxBucket ] )++;
+	}
+
+#endif /* configUSE_QUEUE_STATS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TIMERS == 1 )
 
 	void vQueueWaitForMessageRestricted( QueueHandle_t xQueue, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
@@ -2433,6 +2774,55 @@ BaseType_t xReturn;
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	BaseType_t xQueueMoveWaiterToMutex( List_t * const pxEventList, QueueHandle_t xMutex )
+	{
+	Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+	ListItem_t *pxEventListItem;
+	BaseType_t xReturn = pdFALSE;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION, and
+		pxEventList must be a priority ordered event list that is not empty. */
+		configASSERT( pxMutex );
+		configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+		configASSERT( listLIST_IS_EMPTY( pxEventList ) == pdFALSE );
+
+		/* Record that the task was signalled.  It cannot be inferred from the
+		task's block time, as time spent waiting for the mutex is not part of
+		the wait for the signal. */
+		pxEventListItem = listGET_HEAD_ENTRY( pxEventList );
+		vTaskSetSignalled( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxEventListItem ) );
+
+		if( pxMutex->pxMutexHolder != NULL )
+		{
+			/* The mutex is held, so waking the task would only result in it
+			blocking again on the mutex.  Instead move the task straight from
+			pxEventList to the list of tasks waiting for the mutex - it will be
+			unblocked when the mutex is given.  The task remains in the delayed
+			list, so if its original block time expires first it unblocks and
+			waits for the mutex again from within xCondVarWait().  The event list
+			item value already holds the task's priority, so the move preserves
+			priority order. */
+			( void ) uxListRemove( pxEventListItem );
+			vListInsert( &( pxMutex->xTasksWaitingToReceive ), pxEventListItem );
+
+			/* The mutex holder inherits the priority of the moved task, exactly
+			as if the moved task had blocked on the mutex itself. */
+			vTaskPriorityInheritFromTask( pxMutex->pxMutexHolder, ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxEventListItem ) );
+		}
+		else
+		{
+			/* The mutex is available, so just unblock the task. */
+			xReturn = xTaskRemoveFromEventList( pxEventList );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
@@ -2505,6 +2895,7 @@ BaseType_t xReturn;
 			{
 				/* The queue is no longer contained in the set. */
 				pxQueueOrSemaphore->pxQueueSetContainer = NULL;
+				pxQueueOrSemaphore->xQueueSetPending = pdFALSE;
 			}
 			taskEXIT_CRITICAL();
 			xReturn = pdPASS;
@@ -2523,6 +2914,23 @@ BaseType_t xReturn;
 	QueueSetMemberHandle_t xReturn = NULL;
 
 		( void ) xQueueGenericReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait, pdFALSE ); /*lint !e961 Casting from one typedef to another is not redundant. */
+
+		if( xReturn != NULL )
+		{
+			/* The handle is no longer held in the set, so the member must be
+			notified again when it next receives data or when the caller reads
+			from it and it is still not empty. */
+			taskENTER_CRITICAL();
+			{
+				( ( Queue_t * ) xReturn )->xQueueSetPending = pdFALSE;
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
 		return xReturn;
 	}
 
@@ -2534,8 +2942,23 @@ BaseType_t xReturn;
 	QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
 	{
 	QueueSetMemberHandle_t xReturn = NULL;
+	UBaseType_t uxSavedInterruptStatus;
 
 		( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
+
+		if( xReturn != NULL )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				( ( Queue_t * ) xReturn )->xQueueSetPending = pdFALSE;
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
 		return xReturn;
 	}
 
@@ -2544,7 +2967,7 @@ BaseType_t xReturn;
 
 #if ( configUSE_QUEUE_SETS == 1 )
 
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition )
+	static BaseType_t prvNotifyQueueSetContainer( Queue_t * const pxQueue, const BaseType_t xCopyPosition )
 	{
 	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
 	BaseType_t xReturn = pdFALSE;
@@ -2552,14 +2975,32 @@ BaseType_t xReturn;
 		/* This function must be called form a critical section. */
 
 		configASSERT( pxQueueSetContainer );
-		configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
 
-		if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+		if( pxQueue->xQueueSetPending != pdFALSE )
+		{
+			/* The handle of this queue is already held in the set.  Notifying
+			the set is edge triggered, so the set holds at most one entry per
+			member no matter how many items the member holds, and selecting
+			from the set is independent of the depth of the member queues. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+		else if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
 		{
 			traceQUEUE_SEND( pxQueueSetContainer );
 
-			/* The data copied is the handle of the queue that contains data. */
-			xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, xCopyPosition );
+			/* The data copied is the handle of the queue that contains data.
+			Overwriting a member must not overwrite the handle of a different
+			member that is already held in the set. */
+			if( xCopyPosition == queueOVERWRITE )
+			{
+				xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+			}
+			else
+			{
+				xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, xCopyPosition );
+			}
+
+			pxQueue->xQueueSetPending = pdTRUE;
 
 			if( pxQueueSetContainer->xTxLock == queueUNLOCKED )
 			{
@@ -2587,7 +3028,9 @@ BaseType_t xReturn;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* The set is shorter than the number of queues and semaphores
+			that have been added to it. */
+			configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
 		}
 
 		return xReturn;
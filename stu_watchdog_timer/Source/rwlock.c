@@ -0,0 +1,426 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rwlock.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+
+/* This entire source file will be skipped if the application is not configured
+to include mutex functionality, as priority inheritance is used.  This #if is
+closed at the very bottom of this file.  If you want to include reader-writer
+locks then ensure configUSE_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MUTEXES == 1 )
+
+/*
+ * Definition of a reader-writer lock.
+ *
+ * Ownership is handed directly to waiting tasks when the lock is released, so
+ * a task that takes the lock between the release and the waiting tasks
+ * running cannot starve them.  A waiting writer is recorded as the holder.
+ * Waiting readers are all released together, each is counted in uxReaders
+ * before it runs and is marked as signalled so it knows it already holds the
+ * lock when it does run.
+ */
+typedef struct RWLockDefinition
+{
+	UBaseType_t uxReaders;			/*< The number of tasks that hold the lock for reading, including readers that have been handed the lock but have not yet run. */
+	TaskHandle_t xWriter;			/*< The task that holds the lock for writing, or NULL. */
+	List_t xTasksWaitingToRead;		/*< List of tasks blocked waiting to take the lock for reading.  Stored in priority order. */
+	List_t xTasksWaitingToWrite;	/*< List of tasks blocked waiting to take the lock for writing.  Stored in priority order. */
+} RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+RWLockHandle_t xRWLockCreate( void )
+{
+RWLock_t *pxRWLock;
+
+	pxRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) );
+
+	if( pxRWLock != NULL )
+	{
+		pxRWLock->uxReaders = ( UBaseType_t ) 0;
+		pxRWLock->xWriter = NULL;
+		vListInitialise( &( pxRWLock->xTasksWaitingToRead ) );
+		vListInitialise( &( pxRWLock->xTasksWaitingToWrite ) );
+		traceRWLOCK_CREATE( pxRWLock );
+	}
+	else
+	{
+		traceRWLOCK_CREATE_FAILED();
+	}
+
+	return ( RWLockHandle_t ) pxRWLock;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xEntryTimeSet = pdFALSE, xReturn;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxRWLock );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* As with the alternative queue API, the whole operation is performed
+	within a critical section - including placing the task on the event list.
+	The yield is held pending until the critical section is exited. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( xEntryTimeSet != pdFALSE ) && ( xTaskResetSignalled() != pdFALSE ) )
+			{
+				/* The lock was handed to this task while it was blocked, and
+				the task was counted as a reader at that time. */
+				traceRWLOCK_READ_LOCK( pxRWLock );
+				xReturn = pdPASS;
+			}
+			else if( ( pxRWLock->xWriter == NULL ) && ( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE ) )
+			{
+				/* No task is writing and no writer is waiting. */
+				( pxRWLock->uxReaders )++;
+				traceRWLOCK_READ_LOCK( pxRWLock );
+				xReturn = pdPASS;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				traceRWLOCK_READ_LOCK_FAILED( pxRWLock );
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					traceBLOCKING_ON_RWLOCK_READ( pxRWLock );
+
+					/* If a writer holds the lock it inherits this task's
+					priority. */
+					vTaskPriorityInherit( pxRWLock->xWriter );
+
+					vTaskPlaceOnEventList( &( pxRWLock->xTasksWaitingToRead ), xTicksToWait );
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					/* Timed out.  Try once more with no block time. */
+					xTicksToWait = ( TickType_t ) 0;
+				}
+
+				taskEXIT_CRITICAL();
+				continue;
+			}
+		}
+		taskEXIT_CRITICAL();
+		break;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveRead( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		configASSERT( pxRWLock->uxReaders > ( UBaseType_t ) 0 );
+		( pxRWLock->uxReaders )--;
+		traceRWLOCK_READ_UNLOCK( pxRWLock );
+
+		if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE ) )
+		{
+			/* The last reader has released the lock, so hand it to the highest
+			priority waiting writer. */
+			pxRWLock->xWriter = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) );
+
+			if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+const TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+BaseType_t xEntryTimeSet = pdFALSE, xReturn;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxRWLock );
+	configASSERT( pxRWLock->xWriter != xCurrentTask );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxRWLock->xWriter == xCurrentTask )
+			{
+				/* The lock was handed to this task while it was blocked. */
+				( void ) pvTaskIncrementMutexHeldCount();
+				traceRWLOCK_WRITE_LOCK( pxRWLock );
+				xReturn = pdPASS;
+			}
+			else if( ( pxRWLock->xWriter == NULL ) && ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) )
+			{
+				/* Record the holder so it can inherit priority. */
+				pxRWLock->xWriter = ( TaskHandle_t ) pvTaskIncrementMutexHeldCount();
+				traceRWLOCK_WRITE_LOCK( pxRWLock );
+				xReturn = pdPASS;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				traceRWLOCK_WRITE_LOCK_FAILED( pxRWLock );
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					traceBLOCKING_ON_RWLOCK_WRITE( pxRWLock );
+
+					/* Only a writer can inherit priority - the lock does not
+					know which tasks are reading. */
+					vTaskPriorityInherit( pxRWLock->xWriter );
+
+					vTaskPlaceOnEventList( &( pxRWLock->xTasksWaitingToWrite ), xTicksToWait );
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					/* Timed out.  Try once more with no block time, in case
+					the lock was handed to this task as the time expired. */
+					xTicksToWait = ( TickType_t ) 0;
+				}
+
+				taskEXIT_CRITICAL();
+				continue;
+			}
+		}
+		taskEXIT_CRITICAL();
+		break;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveWrite( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xYieldRequired;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		configASSERT( pxRWLock->xWriter == xTaskGetCurrentTaskHandle() );
+		traceRWLOCK_WRITE_UNLOCK( pxRWLock );
+
+		/* Return to the base priority if a priority was inherited while the
+		lock was held. */
+		xYieldRequired = xTaskPriorityDisinherit( pxRWLock->xWriter );
+		pxRWLock->xWriter = NULL;
+
+		if( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+		{
+			/* Hand the lock to every waiting reader.  Each is counted as a
+			reader now, rather than when it runs, so the lock is held for
+			reading from this point even if a writer is waiting. */
+			while( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+			{
+				vTaskSetSignalled( ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToRead ) ) );
+				( pxRWLock->uxReaders )++;
+
+				if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else if( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE )
+		{
+			/* Hand the lock to the highest priority waiting writer. */
+			pxRWLock->xWriter = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) );
+
+			if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xYieldRequired != pdFALSE )
+		{
+			/* The yield will not be performed until the critical section is
+			exited. */
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockDelete( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+
+	configASSERT( pxRWLock );
+	configASSERT( pxRWLock->uxReaders == ( UBaseType_t ) 0 );
+	configASSERT( pxRWLock->xWriter == NULL );
+	configASSERT( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE );
+	configASSERT( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE );
+
+	traceRWLOCK_DELETE( pxRWLock );
+	vPortFree( pxRWLock );
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include mutex functionality.  If you want to include reader-writer locks then
+ensure configUSE_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MUTEXES == 1 */
+
+
@@ -162,6 +162,7 @@ typedef struct tskTaskControlBlock
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t 	uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
 		UBaseType_t 	uxMutexesHeld;
+		BaseType_t		xSignalled;			/*< Set to pdTRUE when the task is signalled while waiting on a condition variable, or handed a reader-writer lock for reading. */
 	#endif
 
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -785,6 +786,14 @@ StackType_t *pxTopOfStack;
 			can detect that the task lists need re-generating. */
 			uxTaskNumber++;
 
+			#if ( configUSE_HEAP_ACCOUNTING == 1 )
+			{
+				/* The task's handle may be reused once its TCB is freed, so
+				stop charging blocks to the task's heap account. */
+				vPortHeapTaskDeleted( pxTCB );
+			}
+			#endif /* configUSE_HEAP_ACCOUNTING */
+
 			traceTASK_DELETE( pxTCB );
 		}
 		taskEXIT_CRITICAL();
@@ -2575,6 +2584,63 @@ BaseType_t xReturn;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+	{
+	TCB_t *pxUnblockedTCB;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+		called from a critical section within an ISR. */
+
+		/* Store the new item value in the event list. */
+		listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+		pxUnblockedTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+		configASSERT( pxUnblockedTCB );
+		( void ) uxListRemove( pxEventListItem );
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			( void ) uxListRemove( &( pxUnblockedTCB->xGenericListItem ) );
+			prvAddTaskToReadyList( pxUnblockedTCB );
+		}
+		else
+		{
+			/* The delayed and ready lists cannot be accessed, so hold this task
+			pending until the scheduler is resumed.  The item value set above
+			is not altered by moving the item to the pending ready list. */
+			vListInsertEnd( &( xPendingReadyList ), pxEventListItem );
+		}
+
+		if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+		{
+			xReturn = pdTRUE;
+
+			/* Mark that a yield is pending in case the user is not using the
+			"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS
+			function. */
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		#if( configUSE_TICKLESS_IDLE != 0 )
+		{
+			/* See the comment in xTaskRemoveFromEventList(). */
+			prvResetNextTaskUnblockTime();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
 	configASSERT( pxTimeOut );
@@ -2742,6 +2808,20 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 		}
 		#endif /* configUSE_IDLE_HOOK */
 
+		#if ( configUSE_HEAP_CANARIES == 1 )
+		{
+			/* Check a few more of the heap's free blocks for corruption. */
+			( void ) xPortHeapVerifyStep();
+		}
+		#endif /* configUSE_HEAP_CANARIES */
+
+		#if ( configUSE_HEAP_ISR_CACHE == 1 )
+		{
+			/* Replace the heap objects interrupts have taken. */
+			vPortRefillISRCaches();
+		}
+		#endif /* configUSE_HEAP_ISR_CACHE */
+
 		/* This conditional compilation should use inequality to 0, not equality
 		to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
 		user defined low power mode	implementations require
@@ -2872,6 +2952,7 @@ UBaseType_t x;
 	{
 		pxTCB->uxBasePriority = uxPriority;
 		pxTCB->uxMutexesHeld = 0;
+		pxTCB->xSignalled = pdFALSE;
 	}
 	#endif /* configUSE_MUTEXES */
 
@@ -3109,7 +3190,7 @@ TCB_t *pxNewTCB;
 	{
 		/* Allocate space for the TCB.  Where the memory comes from depends on
 		the implementation of the port malloc function. */
-		pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+		pxNewTCB = ( TCB_t * ) pvPortMallocTCB( sizeof( TCB_t ) );
 
 		if( pxNewTCB != NULL )
 		{
@@ -3137,7 +3218,7 @@ TCB_t *pxNewTCB;
 		{
 			/* Allocate space for the TCB.  Where the memory comes from depends
 			on the implementation of the port malloc function. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+			pxNewTCB = ( TCB_t * ) pvPortMallocTCB( sizeof( TCB_t ) );
 
 			if( pxNewTCB != NULL )
 			{
@@ -3416,24 +3497,56 @@ TCB_t *pxTCB;
 #if ( configUSE_MUTEXES == 1 )
 
 	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+	{
+		vTaskPriorityInheritFromTask( pxMutexHolder, pxCurrentTCB );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskSetSignalled( TaskHandle_t const xTask )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+
+		/* Must be called from a critical section. */
+		configASSERT( pxTCB );
+		pxTCB->xSignalled = pdTRUE;
+	}
+	/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskResetSignalled( void )
+	{
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			xReturn = pxCurrentTCB->xSignalled;
+			pxCurrentTCB->xSignalled = pdFALSE;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskPriorityInheritFromTask( TaskHandle_t const pxMutexHolder, TaskHandle_t const pxWaitingTask )
 	{
 	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	TCB_t * const pxWaitingTCB = ( TCB_t * ) pxWaitingTask;
 
 		/* If the mutex was given back by an interrupt while the queue was
 		locked then the mutex holder might now be NULL. */
 		if( pxMutexHolder != NULL )
 		{
 			/* If the holder of the mutex has a priority below the priority of
-			the task attempting to obtain the mutex then it will temporarily
-			inherit the priority of the task attempting to obtain the mutex. */
-			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
+			the task waiting to obtain the mutex then it will temporarily
+			inherit the priority of the task waiting to obtain the mutex. */
+			if( pxTCB->uxPriority < pxWaitingTCB->uxPriority )
 			{
 				/* Adjust the mutex holder state to account for its new
 				priority.  Only reset the event list item value if the value is
 				not	being used for anything else. */
 				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
 				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxWaitingTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 				}
 				else
 				{
@@ -3454,16 +3567,16 @@ TCB_t *pxTCB;
 					}
 
 					/* Inherit the priority before being moved into the new list. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					pxTCB->uxPriority = pxWaitingTCB->uxPriority;
 					prvAddTaskToReadyList( pxTCB );
 				}
 				else
 				{
 					/* Just inherit the priority. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					pxTCB->uxPriority = pxWaitingTCB->uxPriority;
 				}
 
-				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+				traceTASK_PRIORITY_INHERIT( pxTCB, pxWaitingTCB->uxPriority );
 			}
 			else
 			{
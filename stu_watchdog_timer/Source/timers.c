@@ -69,6 +69,7 @@
 
 /* Standard includes. */
 #include <stdlib.h>
+#include <string.h>
 
 /* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
 all the API functions to use the MPU wrappers.  That should only be done when
@@ -100,6 +101,24 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+/* When configUSE_TIMER_DIRECT_COMMANDS is 1 timer commands are applied to the
+active timer lists directly by the task or interrupt that issues them, so the
+timer service task must also access the lists from within a critical section.
+Otherwise only the timer service task accesses the lists and no critical
+section is needed. */
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+	#define tmrENTER_CRITICAL()		taskENTER_CRITICAL()
+	#define tmrEXIT_CRITICAL()		taskEXIT_CRITICAL()
+
+	/* Posted to the timer service task when a command applied directly makes
+	a timer the next to expire, so the task re-evaluates its block time.  The
+	message does not reference a timer. */
+	#define tmrCOMMAND_WAKE_DAEMON	( ( BaseType_t ) 10 )
+#else
+	#define tmrENTER_CRITICAL()
+	#define tmrEXIT_CRITICAL()
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -112,6 +131,12 @@ typedef struct tmrTimerControl
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+	#if( configUSE_TIMER_STATS == 1 )
+		TimerStats_t		xStats;				/*<< Lateness statistics for this timer. */
+	#endif
+	#if( configUSE_TIMER_CATCH_UP_POLICIES == 1 )
+		uint8_t				ucCatchUpPolicy;	/*<< How an auto-reload timer that has fallen a period or more behind is reloaded.  One of the tmrCATCH_UP_ values. */
+	#endif
 } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -168,6 +193,29 @@ PRIVILEGED_DATA static List_t *pxOverflowTimerList;
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
 
+/* The tick count when the timer service task last sampled it.  If the tick
+count is below this value then it has overflowed and the timer lists have not
+yet been switched. */
+PRIVILEGED_DATA static volatile TickType_t xLastTime = ( TickType_t ) 0U;
+
+#if ( configUSE_TIMER_STATS == 1 )
+
+	/* Lateness statistics for all timers together, and the number of times the
+	timer queue was found to be full. */
+	PRIVILEGED_DATA static TimerStats_t xAggregateStats;
+	PRIVILEGED_DATA static uint32_t ulCommandQueueOverruns = 0UL;
+
+#endif
+
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+	/* The number of timer commands that are in the timer queue.  Commands are
+	not applied directly while older commands are still queued, so commands
+	always take effect in the order they were issued. */
+	PRIVILEGED_DATA static volatile UBaseType_t uxQueuedTimerCommands = ( UBaseType_t ) 0U;
+
+#endif
+
 #if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
 
 	PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
@@ -203,11 +251,25 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns pdTRUE if a timer started at xCommandTime to expire at
+ * xNextExpiryTime has already expired at xTimeNow.
+ */
+static BaseType_t prvHasExpiredSinceCommand( const Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if a command later in the batch being processed by
+ * prvProcessReceivedCommands() acts on the same timer as the command at
+ * uxIndex, in which case the list position set by the command at uxIndex would
+ * be discarded.
+ */
+static BaseType_t prvIsCommandSuperseded( const DaemonTaskMessage_t * const pxMessages, const UBaseType_t uxIndex, const UBaseType_t uxReceived ) PRIVILEGED_FUNCTION;
+
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto reload timer, then call its callback.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
@@ -235,6 +297,52 @@ static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIV
  */
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called each time a timer callback is executed, xLateness ticks after the
+ * timer's expiry time.  Updates the statistics, if they are in use, and calls
+ * the trace hook.
+ */
+static void prvRecordLateness( Timer_t * const pxTimer, const TickType_t xLateness ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the time from which an auto-reload timer that expired at
+ * xExpiredTime should be reloaded, so its next expiry time is the returned
+ * value plus its period.  Without catch-up policies, or with the
+ * tmrCATCH_UP_ALL policy, this is always xExpiredTime, so a timer that has
+ * fallen behind executes its callback once for every period it missed.
+ */
+static TickType_t prvGetReloadReference( Timer_t * const pxTimer, const TickType_t xExpiredTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called each time a message could not be posted to the timer queue because
+ * the queue was full.
+ */
+static void prvRecordQueueOverrun( const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMER_STATS == 1 )
+
+	/*
+	 * Add a lateness of xLateness ticks to a set of statistics.
+	 */
+	static void prvUpdateStats( TimerStats_t * const pxStats, const Timer_t * const pxTimer, TickType_t xLateness ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+	/*
+	 * Apply a timer command directly to the active timer lists.  Must be
+	 * called with interrupts masked.  Returns pdFAIL if the command must
+	 * instead be sent to the timer service task - which is the case for
+	 * delete commands, if the tick count has overflowed but the timer lists
+	 * have not yet been switched, if older commands are still queued, or if
+	 * the timer has already expired.  *pxWakeDaemon is set to pdTRUE if the
+	 * timer service task needs to re-evaluate its block time.
+	 */
+	static BaseType_t prvApplyCommandDirectly( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxWakeDaemon ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
@@ -298,6 +406,18 @@ Timer_t *pxNewTimer;
 			pxNewTimer->pxCallbackFunction = pxCallbackFunction;
 			vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
+			#if( configUSE_TIMER_CATCH_UP_POLICIES == 1 )
+			{
+				pxNewTimer->ucCatchUpPolicy = ( uint8_t ) tmrCATCH_UP_ALL;
+			}
+			#endif /* configUSE_TIMER_CATCH_UP_POLICIES */
+
+			#if( configUSE_TIMER_STATS == 1 )
+			{
+				( void ) memset( ( void * ) &( pxNewTimer->xStats ), 0x00, sizeof( TimerStats_t ) );
+			}
+			#endif /* configUSE_TIMER_STATS */
+
 			traceTIMER_CREATE( pxNewTimer );
 		}
 		else
@@ -324,6 +444,67 @@ DaemonTaskMessage_t xMessage;
 	on a particular timer definition. */
 	if( xTimerQueue != NULL )
 	{
+		#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+		{
+		BaseType_t xWakeDaemon = pdFALSE;
+		UBaseType_t uxSavedInterruptStatus;
+
+			/* Try applying the command to the timer lists directly, within a
+			short critical section, so it takes effect immediately and does
+			not occupy space in the timer queue. */
+			if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+			{
+				taskENTER_CRITICAL();
+				{
+					xReturn = prvApplyCommandDirectly( ( Timer_t * ) xTimer, xCommandID, xOptionalValue, &xWakeDaemon );
+				}
+				taskEXIT_CRITICAL();
+			}
+			else
+			{
+				uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+				{
+					xReturn = prvApplyCommandDirectly( ( Timer_t * ) xTimer, xCommandID, xOptionalValue, &xWakeDaemon );
+				}
+				portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+			}
+
+			if( xReturn != pdFAIL )
+			{
+				if( xWakeDaemon != pdFALSE )
+				{
+					/* The timer is now the next to expire, so the timer service
+					task must re-calculate its block time.  If the queue is full
+					the task will run to empty it anyway, so the result of the
+					send is not needed. */
+					xMessage.xMessageID = tmrCOMMAND_WAKE_DAEMON;
+					xMessage.u.xTimerParameters.xMessageValue = ( TickType_t ) 0U;
+					xMessage.u.xTimerParameters.pxTimer = NULL;
+
+					if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+					{
+						( void ) xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+					}
+					else
+					{
+						( void ) xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+				return xReturn;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TIMER_DIRECT_COMMANDS */
+
 		/* Send a command to the timer service task to start the xTimer timer. */
 		xMessage.xMessageID = xCommandID;
 		xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
@@ -331,6 +512,18 @@ DaemonTaskMessage_t xMessage;
 
 		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
 		{
+			#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+			{
+				/* Counted before the command is sent so the timer service task
+				cannot process the command before it has been counted. */
+				taskENTER_CRITICAL();
+				{
+					( uxQueuedTimerCommands )++;
+				}
+				taskEXIT_CRITICAL();
+			}
+			#endif
+
 			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
 			{
 				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
@@ -339,10 +532,61 @@ DaemonTaskMessage_t xMessage;
 			{
 				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
 			}
+
+			#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+			{
+				if( xReturn == pdFAIL )
+				{
+					taskENTER_CRITICAL();
+					{
+						( uxQueuedTimerCommands )--;
+					}
+					taskEXIT_CRITICAL();
+				}
+			}
+			#endif
+
+			if( xReturn == pdFAIL )
+			{
+				prvRecordQueueOverrun( pdFALSE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
-			xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+			{
+			UBaseType_t uxSavedInterruptStatus;
+
+				uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+				{
+					( uxQueuedTimerCommands )++;
+					xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+
+					if( xReturn == pdFAIL )
+					{
+						( uxQueuedTimerCommands )--;
+					}
+				}
+				portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+			}
+			#else
+			{
+				xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			}
+			#endif
+
+			if( xReturn == pdFAIL )
+			{
+				prvRecordQueueOverrun( pdTRUE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 
 		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
@@ -378,42 +622,74 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+static void prvProcessExpiredTimer( TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
-BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
-
-	/* Remove the timer from the list of active timers.  A check has already
-	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-	traceTIMER_EXPIRED( pxTimer );
+BaseType_t xResult, xReloadNow = pdFALSE;
+Timer_t *pxTimer;
+TickType_t xReloadReference = ( TickType_t ) 0U;
 
-	/* If the timer is an auto reload timer then calculate the next
-	expiry time and re-insert the timer in the list of active timers. */
-	if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+	tmrENTER_CRITICAL();
 	{
-		/* The timer is inserted into a list using a time relative to anything
-		other than the current time.  It will therefore be inserted into the
-		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) == pdTRUE )
+		#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
 		{
-			/* The timer expired before it was added to the active timer
-			list.  Reload it now.  */
-			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-			configASSERT( xResult );
-			( void ) xResult;
+			/* The timer that was at the head of the list when the expire time
+			was obtained may since have been stopped or restarted directly by
+			another task or an interrupt, so check again. */
+			if( listLIST_IS_EMPTY( pxCurrentTimerList ) != pdFALSE )
+			{
+				tmrEXIT_CRITICAL();
+				return;
+			}
+
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+			if( xNextExpireTime > xTimeNow )
+			{
+				tmrEXIT_CRITICAL();
+				return;
+			}
+		}
+		#endif /* configUSE_TIMER_DIRECT_COMMANDS */
+
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+		/* Remove the timer from the list of active timers.  A check has already
+		been performed to ensure the list is not empty. */
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		traceTIMER_EXPIRED( pxTimer );
+
+		/* If the timer is an auto reload timer then calculate the next
+		expiry time and re-insert the timer in the list of active timers. */
+		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		{
+			/* The timer is inserted into a list using a time relative to anything
+			other than the current time.  It will therefore be inserted into the
+			correct list relative to the time this task thinks it is now. */
+			xReloadReference = prvGetReloadReference( pxTimer, xNextExpireTime, xTimeNow );
+			xReloadNow = prvInsertTimerInActiveList( pxTimer, ( xReloadReference + pxTimer->xTimerPeriodInTicks ), xTimeNow, xReloadReference );
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
+	tmrEXIT_CRITICAL();
+
+	if( xReloadNow == pdTRUE )
+	{
+		/* The timer expired before it was added to the active timer
+		list.  Reload it now.  */
+		xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xReloadReference, NULL, tmrNO_DELAY );
+		configASSERT( xResult );
+		( void ) xResult;
+	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
 	/* Call the timer callback. */
+	prvRecordLateness( pxTimer, xTimeNow - xNextExpireTime );
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
 /*-----------------------------------------------------------*/
@@ -513,16 +789,20 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
-	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-	}
-	else
+	tmrENTER_CRITICAL();
 	{
-		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+		if( *pxListWasEmpty == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		}
+		else
+		{
+			/* Ensure the task unblocks when the tick count rolls over. */
+			xNextExpireTime = ( TickType_t ) 0U;
+		}
 	}
+	tmrEXIT_CRITICAL();
 
 	return xNextExpireTime;
 }
@@ -531,7 +811,6 @@ TickType_t xNextExpireTime;
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
 
 	xTimeNow = xTaskGetTickCount();
 
@@ -545,7 +824,13 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 		*pxTimerListsWereSwitched = pdFALSE;
 	}
 
-	xLastTime = xTimeNow;
+	/* Only written by the timer service task, but read by tasks and
+	interrupts that apply commands directly. */
+	tmrENTER_CRITICAL();
+	{
+		xLastTime = xTimeNow;
+	}
+	tmrEXIT_CRITICAL();
 
 	return xTimeNow;
 }
@@ -558,6 +843,28 @@ BaseType_t xProcessTimerNow = pdFALSE;
 	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
 	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
+	if( prvHasExpiredSinceCommand( pxTimer, xNextExpiryTime, xTimeNow, xCommandTime ) != pdFALSE )
+	{
+		xProcessTimerNow = pdTRUE;
+	}
+	else if( xNextExpiryTime <= xTimeNow )
+	{
+		/* The expiry time has overflowed. */
+		vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+	}
+	else
+	{
+		vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+	}
+
+	return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvHasExpiredSinceCommand( const Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xReturn = pdFALSE;
+
 	if( xNextExpiryTime <= xTimeNow )
 	{
 		/* Has the expiry time elapsed between the command to start/reset a
@@ -566,11 +873,11 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		{
 			/* The time between a command being issued and the command being
 			processed actually exceeds the timers period.  */
-			xProcessTimerNow = pdTRUE;
+			xReturn = pdTRUE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			mtCOVERAGE_TEST_MARKER();
 		}
 	}
 	else
@@ -580,147 +887,305 @@ BaseType_t xProcessTimerNow = pdFALSE;
 			/* If, since the command was issued, the tick count has overflowed
 			but the expiry time has not, then the timer must have already passed
 			its expiry time and should be processed immediately. */
-			xProcessTimerNow = pdTRUE;
+			xReturn = pdTRUE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			mtCOVERAGE_TEST_MARKER();
 		}
 	}
 
-	return xProcessTimerNow;
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
 static void	prvProcessReceivedCommands( void )
 {
-DaemonTaskMessage_t xMessage;
+DaemonTaskMessage_t xMessages[ configTIMER_COMMAND_BATCH_LENGTH ];
+const DaemonTaskMessage_t *pxMessage;
 Timer_t *pxTimer;
-BaseType_t xTimerListsWereSwitched, xResult;
+BaseType_t xTimerListsWereSwitched, xResult, xSuperseded, xProcessTimerNow = pdFALSE;
 TickType_t xTimeNow;
+UBaseType_t uxReceived, uxIndex;
 
-	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+	for( ;; )
 	{
-		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+		/* Drain the command queue in batches so commands that are superseded
+		by a later command on the same timer within the batch can be skipped
+		rather than each one removing and re-inserting the timer. */
+		uxReceived = ( UBaseType_t ) 0U;
+		while( ( uxReceived < ( UBaseType_t ) configTIMER_COMMAND_BATCH_LENGTH ) && ( xQueueReceive( xTimerQueue, &( xMessages[ uxReceived ] ), tmrNO_DELAY ) != pdFAIL ) ) /*lint !e603 xMessages does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 		{
-			/* Negative commands are pended function calls rather than timer
-			commands. */
-			if( xMessage.xMessageID < ( BaseType_t ) 0 )
-			{
-				const CallbackParameters_t * const pxCallback = &( xMessage.u.xCallbackParameters );
-
-				/* The timer uses the xCallbackParameters member to request a
-				callback be executed.  Check the callback is not NULL. */
-				configASSERT( pxCallback );
+			( uxReceived )++;
+		}
 
-				/* Call the function. */
-				pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+		if( uxReceived == ( UBaseType_t ) 0U )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif /* INCLUDE_xTimerPendFunctionCall */
 
-		/* Commands that are positive are timer commands rather than pended
-		function calls. */
-		if( xMessage.xMessageID >= ( BaseType_t ) 0 )
+		/* In this case the xTimerListsWereSwitched parameter is not used, but
+		it must be present in the function call.  prvSampleTimeNow() must be
+		called after the messages are received from xTimerQueue so there is no
+		possibility of a higher priority task adding a message to the message
+		queue with a time that is ahead of the timer daemon task (because it
+		pre-empted the timer daemon task after the xTimeNow value was set).
+		It is called before any timer is removed from its list as switching
+		the lists may process the timer.  One sample serves the whole batch. */
+		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxReceived; uxIndex++ )
 		{
-			/* The messages uses the xTimerParameters member to work on a
-			software timer. */
-			pxTimer = xMessage.u.xTimerParameters.pxTimer;
+			pxMessage = &( xMessages[ uxIndex ] );
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+			#if ( INCLUDE_xTimerPendFunctionCall == 1 )
 			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				/* Negative commands are pended function calls rather than timer
+				commands. */
+				if( pxMessage->xMessageID < ( BaseType_t ) 0 )
+				{
+					const CallbackParameters_t * const pxCallback = &( pxMessage->u.xCallbackParameters );
+
+					/* The timer uses the xCallbackParameters member to request a
+					callback be executed.  Check the callback is not NULL. */
+					configASSERT( pxCallback );
+
+					/* Call the function. */
+					pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-			else
+			#endif /* INCLUDE_xTimerPendFunctionCall */
+
+			#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* A wake message only causes the timer service task to
+				re-evaluate its block time, which it does on leaving this
+				function. */
+				if( pxMessage->xMessageID == tmrCOMMAND_WAKE_DAEMON )
+				{
+					continue;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			#endif /* configUSE_TIMER_DIRECT_COMMANDS */
 
-			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
-
-			/* In this case the xTimerListsWereSwitched parameter is not used, but
-			it must be present in the function call.  prvSampleTimeNow() must be
-			called after the message is received from xTimerQueue so there is no
-			possibility of a higher priority task adding a message to the message
-			queue with a time that is ahead of the timer daemon task (because it
-			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
-
-			switch( xMessage.xMessageID )
+			/* Commands that are positive are timer commands rather than pended
+			function calls. */
+			if( pxMessage->xMessageID >= ( BaseType_t ) 0 )
 			{
-				case tmrCOMMAND_START :
-			    case tmrCOMMAND_START_FROM_ISR :
-			    case tmrCOMMAND_RESET :
-			    case tmrCOMMAND_RESET_FROM_ISR :
-				case tmrCOMMAND_START_DONT_TRACE :
-					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) == pdTRUE )
+				/* The messages uses the xTimerParameters member to work on a
+				software timer. */
+				pxTimer = pxMessage->u.xTimerParameters.pxTimer;
+				traceTIMER_COMMAND_RECEIVED( pxTimer, pxMessage->xMessageID, pxMessage->u.xTimerParameters.xMessageValue );
+
+				/* Every timer command removes the timer from the active list
+				before acting on it, so the list position set by this command
+				is discarded if a later command in the batch targets the same
+				timer.  Delete commands must always be processed so the memory
+				is freed. */
+				if( pxMessage->xMessageID != tmrCOMMAND_DELETE )
+				{
+					xSuperseded = prvIsCommandSuperseded( xMessages, uxIndex, uxReceived );
+				}
+				else
+				{
+					xSuperseded = pdFALSE;
+				}
+
+				tmrENTER_CRITICAL();
+				{
+					if( xSuperseded != pdFALSE )
+					{
+						switch( pxMessage->xMessageID )
+						{
+							case tmrCOMMAND_START :
+						    case tmrCOMMAND_START_FROM_ISR :
+						    case tmrCOMMAND_RESET :
+						    case tmrCOMMAND_RESET_FROM_ISR :
+							case tmrCOMMAND_START_DONT_TRACE :
+								/* A start command that has already expired
+								must still execute the callback. */
+								if( prvHasExpiredSinceCommand( pxTimer, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, pxMessage->u.xTimerParameters.xMessageValue ) != pdFALSE )
+								{
+									xSuperseded = pdFALSE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+								break;
+
+							case tmrCOMMAND_CHANGE_PERIOD :
+							case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+								/* The new period still applies to the later
+								command. */
+								pxTimer->xTimerPeriodInTicks = pxMessage->u.xTimerParameters.xMessageValue;
+								configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+								break;
+
+							default :
+								break;
+						}
+					}
+					else
 					{
-						/* The timer expired before it was added to the active
-						timer list.  Process it now. */
-						pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-						traceTIMER_EXPIRED( pxTimer );
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-						if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+					if( xSuperseded == pdFALSE )
+					{
+						if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
 						{
-							xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
-							configASSERT( xResult );
-							( void ) xResult;
+							/* The timer is in a list, remove it. */
+							( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
+
+						switch( pxMessage->xMessageID )
+						{
+							case tmrCOMMAND_START :
+						    case tmrCOMMAND_START_FROM_ISR :
+						    case tmrCOMMAND_RESET :
+						    case tmrCOMMAND_RESET_FROM_ISR :
+							case tmrCOMMAND_START_DONT_TRACE :
+								/* Start or restart a timer. */
+								xProcessTimerNow = prvInsertTimerInActiveList( pxTimer,  pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, pxMessage->u.xTimerParameters.xMessageValue );
+								break;
+
+							case tmrCOMMAND_CHANGE_PERIOD :
+							case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+								pxTimer->xTimerPeriodInTicks = pxMessage->u.xTimerParameters.xMessageValue;
+								configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+								/* The new period does not really have a reference, and can be
+								longer or shorter than the old one.  The command time is
+								therefore set to the current time, and as the period cannot be
+								zero the next expiry time can only be in the future, meaning
+								(unlike for the xTimerStart() case above) there is no fail case
+								that needs to be handled here. */
+								( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+								break;
+
+							default :
+								/* Stop and delete commands only remove the timer from
+								the active list, which has already been done. */
+								break;
+						}
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						/* Nothing else to do, the later command sets the
+						final state of the timer. */
+						xProcessTimerNow = pdFALSE;
 					}
-					break;
-
-				case tmrCOMMAND_STOP :
-				case tmrCOMMAND_STOP_FROM_ISR :
-					/* The timer has already been removed from the active list.
-					There is nothing to do here. */
-					break;
 
-				case tmrCOMMAND_CHANGE_PERIOD :
-				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
-					pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+					#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+					{
+						/* The command has been applied, so later commands can
+						again be applied directly. */
+						configASSERT( uxQueuedTimerCommands );
+						( uxQueuedTimerCommands )--;
+					}
+					#endif /* configUSE_TIMER_DIRECT_COMMANDS */
+				}
+				tmrEXIT_CRITICAL();
 
-					/* The new period does not really have a reference, and can be
-					longer or shorter than the old one.  The command time is
-					therefore set to the current time, and as the period cannot be
-					zero the next expiry time can only be in the future, meaning
-					(unlike for the xTimerStart() case above) there is no fail case
-					that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-					break;
+				switch( pxMessage->xMessageID )
+				{
+					case tmrCOMMAND_START :
+				    case tmrCOMMAND_START_FROM_ISR :
+				    case tmrCOMMAND_RESET :
+				    case tmrCOMMAND_RESET_FROM_ISR :
+					case tmrCOMMAND_START_DONT_TRACE :
+						if( xProcessTimerNow == pdTRUE )
+						{
+							/* The timer expired before it was added to the active
+							timer list.  Process it now. */
+							prvRecordLateness( pxTimer, xTimeNow - ( pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks ) );
+							pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+							traceTIMER_EXPIRED( pxTimer );
+
+							if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+							{
+								xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, prvGetReloadReference( pxTimer, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow ), NULL, tmrNO_DELAY );
+								configASSERT( xResult );
+								( void ) xResult;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+						break;
+
+					case tmrCOMMAND_STOP :
+					case tmrCOMMAND_STOP_FROM_ISR :
+					case tmrCOMMAND_CHANGE_PERIOD :
+					case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+						/* The active list has already been updated.  There is
+						nothing to do here. */
+						break;
+
+					case tmrCOMMAND_DELETE :
+						/* The timer has already been removed from the active list,
+						just free up the memory. */
+						vPortFree( pxTimer );
+						break;
+
+					default	:
+						/* Don't expect to get here. */
+						break;
+				}
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
 
-				case tmrCOMMAND_DELETE :
-					/* The timer has already been removed from the active list,
-					just free up the memory. */
-					vPortFree( pxTimer );
-					break;
+static BaseType_t prvIsCommandSuperseded( const DaemonTaskMessage_t * const pxMessages, const UBaseType_t uxIndex, const UBaseType_t uxReceived )
+{
+UBaseType_t uxLater;
+BaseType_t xReturn = pdFALSE;
 
-				default	:
-					/* Don't expect to get here. */
-					break;
-			}
+	for( uxLater = uxIndex + ( UBaseType_t ) 1U; uxLater < uxReceived; uxLater++ )
+	{
+		/* Only positive commands use the xTimerParameters member. */
+		if( ( pxMessages[ uxLater ].xMessageID >= ( BaseType_t ) 0 ) && ( pxMessages[ uxLater ].u.xTimerParameters.pxTimer == pxMessages[ uxIndex ].u.xTimerParameters.pxTimer ) )
+		{
+			xReturn = pdTRUE;
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
 	}
+
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
 static void prvSwitchTimerLists( void )
 {
-TickType_t xNextExpireTime, xReloadTime;
+TickType_t xNextExpireTime, xReloadTime, xReloadReference;
 List_t *pxTemp;
 Timer_t *pxTimer;
 BaseType_t xResult;
@@ -729,18 +1194,32 @@ BaseType_t xResult;
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
 	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	for( ;; )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		tmrENTER_CRITICAL();
+		{
+			if( listLIST_IS_EMPTY( pxCurrentTimerList ) != pdFALSE )
+			{
+				/* Leave the critical section entered, it is exited once the
+				lists have been switched below. */
+				break;
+			}
+
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+			/* Remove the timer from the list. */
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		}
+		tmrEXIT_CRITICAL();
 
-		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
-		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 		traceTIMER_EXPIRED( pxTimer );
 
 		/* Execute its callback, then send a command to restart the timer if
 		it is an auto-reload timer.  It cannot be restarted here as the lists
-		have not yet been switched. */
+		have not yet been switched.  The tick count has overflowed since the
+		expiry time, which unsigned subtraction allows for. */
+		prvRecordLateness( pxTimer, xTaskGetTickCount() - xNextExpireTime );
 		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 
 		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
@@ -751,16 +1230,21 @@ BaseType_t xResult;
 			processed again within this loop.  Otherwise a command should be sent
 			to restart the timer to ensure it is only inserted into a list after
 			the lists have been swapped. */
-			xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
-			if( xReloadTime > xNextExpireTime )
+			xReloadReference = prvGetReloadReference( pxTimer, xNextExpireTime, xTaskGetTickCount() );
+			xReloadTime = ( xReloadReference + pxTimer->xTimerPeriodInTicks );
+			if( ( xReloadReference == xNextExpireTime ) && ( xReloadTime > xNextExpireTime ) )
 			{
-				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
-				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				tmrENTER_CRITICAL();
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
+					listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+					vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				}
+				tmrEXIT_CRITICAL();
 			}
 			else
 			{
-				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xReloadReference, NULL, tmrNO_DELAY );
 				configASSERT( xResult );
 				( void ) xResult;
 			}
@@ -774,9 +1258,301 @@ BaseType_t xResult;
 	pxTemp = pxCurrentTimerList;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
+	tmrEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordLateness( Timer_t * const pxTimer, const TickType_t xLateness )
+{
+	traceTIMER_LATENESS( pxTimer, xLateness );
+
+	#if ( configUSE_TIMER_STATS == 1 )
+	{
+		/* The statistics can be read by other tasks. */
+		taskENTER_CRITICAL();
+		{
+			prvUpdateStats( &( pxTimer->xStats ), pxTimer, xLateness );
+			prvUpdateStats( &xAggregateStats, pxTimer, xLateness );
+		}
+		taskEXIT_CRITICAL();
+	}
+	#else
+	{
+		( void ) pxTimer;
+		( void ) xLateness;
+	}
+	#endif /* configUSE_TIMER_STATS */
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetReloadReference( Timer_t * const pxTimer, const TickType_t xExpiredTime, const TickType_t xTimeNow )
+{
+TickType_t xReference = xExpiredTime;
+
+	#if ( configUSE_TIMER_CATCH_UP_POLICIES == 1 )
+	{
+	TickType_t xMissedPeriods;
+
+		/* The number of whole periods that have passed since the expiry time,
+		each of which would otherwise result in another callback. */
+		xMissedPeriods = ( TickType_t ) ( ( xTimeNow - xExpiredTime ) / pxTimer->xTimerPeriodInTicks );
+
+		if( ( xMissedPeriods != ( TickType_t ) 0U ) && ( pxTimer->ucCatchUpPolicy != ( uint8_t ) tmrCATCH_UP_ALL ) )
+		{
+			if( pxTimer->ucCatchUpPolicy == ( uint8_t ) tmrCATCH_UP_SKIP )
+			{
+				/* Keep the original phase, expiring next on the first period
+				boundary that is still in the future. */
+				xReference = xExpiredTime + ( xMissedPeriods * pxTimer->xTimerPeriodInTicks );
+			}
+			else
+			{
+				/* tmrCATCH_UP_REPHASE - the next expiry is one whole period
+				after now. */
+				xReference = xTimeNow;
+			}
+
+			traceTIMER_PERIODS_SKIPPED( pxTimer, xMissedPeriods );
+
+			#if ( configUSE_TIMER_STATS == 1 )
+			{
+				taskENTER_CRITICAL();
+				{
+					pxTimer->xStats.ulSkippedPeriods += ( uint32_t ) xMissedPeriods;
+					xAggregateStats.ulSkippedPeriods += ( uint32_t ) xMissedPeriods;
+				}
+				taskEXIT_CRITICAL();
+			}
+			#endif /* configUSE_TIMER_STATS */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		( void ) pxTimer;
+		( void ) xTimeNow;
+	}
+	#endif /* configUSE_TIMER_CATCH_UP_POLICIES */
+
+	return xReference;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordQueueOverrun( const BaseType_t xFromISR )
+{
+	traceTIMER_COMMAND_QUEUE_OVERRUN();
+
+	#if ( configUSE_TIMER_STATS == 1 )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		if( xFromISR == pdFALSE )
+		{
+			taskENTER_CRITICAL();
+			{
+				ulCommandQueueOverruns++;
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				ulCommandQueueOverruns++;
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+	}
+	#else
+	{
+		( void ) xFromISR;
+	}
+	#endif /* configUSE_TIMER_STATS */
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_STATS == 1 )
+
+	static void prvUpdateStats( TimerStats_t * const pxStats, const Timer_t * const pxTimer, TickType_t xLateness )
+	{
+	UBaseType_t uxBucket = ( UBaseType_t ) 0U;
+
+		( pxStats->ulExpiries )++;
+
+		if( xLateness > pxStats->xMaxLateness )
+		{
+			pxStats->xMaxLateness = xLateness;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* An auto-reload timer that is a whole period or more late has missed
+		at least one period.  The callbacks for the missed periods still
+		execute, but late. */
+		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		{
+			pxStats->ulMissedPeriods += ( uint32_t ) ( xLateness / pxTimer->xTimerPeriodInTicks );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Bucket 0 counts callbacks that executed on time, and bucket n counts
+		callbacks that executed between 2^(n-1) and (2^n)-1 ticks late.  The
+		last bucket also counts every callback that was later still. */
+		while( ( xLateness != ( TickType_t ) 0 ) && ( uxBucket < ( UBaseType_t ) ( configTIMER_STATS_LATENESS_BUCKETS - 1 ) ) )
+		{
+			xLateness >>= 1;
+			uxBucket++;
+		}
+
+		( pxStats->ulLatenessHistogram[ uxBucket ] )++;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTimerGetStats( TimerHandle_t xTimer, TimerStats_t *pxStats )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( pxStats );
+
+		taskENTER_CRITICAL();
+		{
+			if( pxTimer == NULL )
+			{
+				*pxStats = xAggregateStats;
+			}
+			else
+			{
+				*pxStats = pxTimer->xStats;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTimerResetStats( TimerHandle_t xTimer )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		taskENTER_CRITICAL();
+		{
+			if( pxTimer == NULL )
+			{
+				( void ) memset( ( void * ) &xAggregateStats, 0x00, sizeof( TimerStats_t ) );
+				ulCommandQueueOverruns = 0UL;
+			}
+			else
+			{
+				( void ) memset( ( void * ) &( pxTimer->xStats ), 0x00, sizeof( TimerStats_t ) );
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulTimerGetCommandQueueOverruns( void )
+	{
+		/* A single 32-bit read does not need a critical section on the ports
+		that use this option. */
+		return ulCommandQueueOverruns;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TIMER_STATS */
+
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+	static BaseType_t prvApplyCommandDirectly( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxWakeDaemon )
+	{
+	TickType_t xTimeNow;
+	BaseType_t xReturn = pdPASS;
+
+		/* Called with interrupts masked, so the tick count cannot change and
+		the timer service task cannot access the lists. */
+		xTimeNow = xTaskGetTickCountFromISR();
+
+		/* Commands are queued if older commands have still to be processed, if
+		the tick count has overflowed since the timer service task last ran (so
+		the current and overflow lists are not yet the right way around), or if
+		the command has to free memory. */
+		if( ( uxQueuedTimerCommands != ( UBaseType_t ) 0U ) || ( xTimeNow < xLastTime ) || ( xCommandID == tmrCOMMAND_DELETE ) )
+		{
+			return pdFAIL;
+		}
+
+		if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+		{
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		switch( xCommandID )
+		{
+			case tmrCOMMAND_START :
+			case tmrCOMMAND_START_FROM_ISR :
+			case tmrCOMMAND_RESET :
+			case tmrCOMMAND_RESET_FROM_ISR :
+			case tmrCOMMAND_START_DONT_TRACE :
+				if( prvInsertTimerInActiveList( pxTimer, xOptionalValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xOptionalValue ) == pdTRUE )
+				{
+					/* The timer has already expired, so its callback must be
+					executed by the timer service task.  Leave the timer out of
+					the lists and queue the command instead. */
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				break;
+
+			case tmrCOMMAND_CHANGE_PERIOD :
+			case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+				pxTimer->xTimerPeriodInTicks = xOptionalValue;
+				configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+				( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+				break;
+
+			default :
+				/* Stop commands only remove the timer from the active list. */
+				break;
+		}
+
+		/* If the timer is now the next to expire the timer service task may be
+		blocked for too long.  Removing a timer at most makes it unblock early,
+		which is harmless. */
+		if( ( xReturn != pdFAIL ) && ( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE ) )
+		{
+			if( listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ) == ( void * ) pxTimer )
+			{
+				*pxWakeDaemon = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_DIRECT_COMMANDS */
+/*-----------------------------------------------------------*/
+
 static void prvCheckForValidListAndQueue( void )
 {
 	/* Check that the list from which active timers are referenced, and the
@@ -867,6 +1643,34 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_CATCH_UP_POLICIES == 1 )
+
+	void vTimerSetCatchUpPolicy( TimerHandle_t xTimer, const UBaseType_t uxPolicy )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+		configASSERT( uxPolicy <= tmrCATCH_UP_REPHASE );
+
+		taskENTER_CRITICAL();
+		{
+			pxTimer->ucCatchUpPolicy = ( uint8_t ) uxPolicy;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTimerGetCatchUpPolicy( TimerHandle_t xTimer )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+		return ( UBaseType_t ) pxTimer->ucCatchUpPolicy;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TIMER_CATCH_UP_POLICIES */
+
 #if( INCLUDE_xTimerPendFunctionCall == 1 )
 
 	BaseType_t xTimerPendFunctionCallFromISR( PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken )
@@ -883,6 +1687,15 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 
 		xReturn = xQueueSendFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
 
+		if( xReturn == pdFAIL )
+		{
+			prvRecordQueueOverrun( pdTRUE );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
 		tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
 		return xReturn;
@@ -912,6 +1725,15 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 
 		xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
 
+		if( xReturn == pdFAIL )
+		{
+			prvRecordQueueOverrun( pdFALSE );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
 		tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
 		return xReturn;
@@ -0,0 +1,422 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares the time taken to make and release the temporary allocations of a
+ * typical request handler when they come from the FreeRTOS heap, and when they
+ * come from an arena (see arena.h).
+ *
+ * A single task repeatedly generates a request.  A request allocates a receive
+ * buffer, a number of small token buffers, a lookup table and a response
+ * buffer, with sizes chosen at random.  The same sequence of sizes is played
+ * twice - first using pvPortMalloc(), with every block then freed by
+ * vPortFree(), and then using pvArenaAlloc(), with every block then released
+ * by a single call to vArenaReset().  Each block is filled with a pattern that
+ * is checked before the block is released, to detect blocks that overlap.
+ *
+ * Each call is timed with the scheduler suspended, and the times of all the
+ * calls made for a request are added together to give the time of the
+ * request.  After every abREQUESTS_PER_CYCLE requests the task delays for
+ * abCYCLE_DELAY so it does not starve lower priority tasks.  The worst and
+ * average request times can be obtained by calling vGetArenaBenchmarkResults().
+ *
+ * Times are measured with abGET_TIMESTAMP(), which is selected in the same way
+ * as hbGET_TIMESTAMP() in HeapBenchmark.c.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "arena.h"
+
+/* Demo program include files. */
+#include "ArenaBenchmark.h"
+
+#ifndef abGET_TIMESTAMP
+	#if( configUSE_HRTIMERS == 1 )
+		#include "hrtimer.h"
+		#define abGET_TIMESTAMP()	ulHRTimerGetCount()
+	#elif( configGENERATE_RUN_TIME_STATS == 1 )
+		#define abGET_TIMESTAMP()	( ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() )
+	#else
+		#define abGET_TIMESTAMP()	( ( uint32_t ) xTaskGetTickCount() )
+	#endif
+#endif
+
+/* The most blocks a request allocates - a receive buffer, a lookup table, a
+response buffer and up to abMAX_TOKENS tokens. */
+#define abMAX_TOKENS				( 16UL )
+#define abMAX_BLOCKS				( abMAX_TOKENS + 3UL )
+
+/* Sizes of the blocks that are allocated. */
+#define abMIN_RECEIVE_SIZE			( 64UL )
+#define abMAX_RECEIVE_SIZE			( 512UL )
+#define abMAX_TOKEN_SIZE			( 48UL )
+#define abMAX_TABLE_SIZE			( 256UL )
+#define abMAX_RESPONSE_SIZE			( 768UL )
+
+/* The usable size of each chunk of the arena.  Most requests fit in one
+chunk, but the largest need a second. */
+#define abARENA_CHUNK_SIZE			( 1024UL )
+
+/* The number of requests between delays. */
+#define abREQUESTS_PER_CYCLE		( 50UL )
+#define abCYCLE_DELAY				( pdMS_TO_TICKS( 20UL ) + ( TickType_t ) 1 )
+
+/* Constants used by the pseudo random number generator. */
+#define abRAND_MULTIPLIER			( 1664525UL )
+#define abRAND_INCREMENT			( 1013904223UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task described at the top of this file.
+ */
+static void prvArenaBenchmarkTask( void *pvParameters );
+
+/*
+ * Generate the sizes of the blocks allocated by the next request.
+ */
+static void prvGenerateRequest( void );
+
+/*
+ * Make the allocations of the current request using the FreeRTOS heap or the
+ * arena, then check and release them.  Returns the time spent in the calls.
+ */
+static uint32_t prvRunRequestOnHeap( void );
+static uint32_t prvRunRequestOnArena( void );
+
+/*
+ * Fill, or check, the blocks allocated for the current request.
+ */
+static void prvFillBlock( UBaseType_t uxBlock );
+static void prvCheckBlock( UBaseType_t uxBlock );
+
+/*
+ * Record the time taken by a request.
+ */
+static void prvRecordTime( uint32_t ulElapsed, uint32_t *pulWorst, uint64_t *pullTotal );
+
+/*
+ * A linear congruential generator - the sequence only needs to be
+ * repeatable, not good.
+ */
+static uint32_t prvRand( void );
+
+/*-----------------------------------------------------------*/
+
+/* The request being processed. */
+static uint8_t *pucBlocks[ abMAX_BLOCKS ] = { NULL };
+static size_t xBlockSizes[ abMAX_BLOCKS ] = { 0 };
+static UBaseType_t uxBlockCount = 0;
+
+static ArenaHandle_t xArena = NULL;
+
+static uint32_t ulNextRand = 0x87654321UL;
+
+/* The timing results. */
+static uint32_t ulWorstHeapTime = 0, ulWorstArenaTime = 0;
+static uint64_t ullTotalHeapTime = 0, ullTotalArenaTime = 0;
+static volatile uint32_t ulRequests = 0, ulLastRequests = 0;
+static volatile uint32_t ulAllocationFailures = 0;
+
+/* Set to pdFAIL if an error is found. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/*-----------------------------------------------------------*/
+
+void vStartArenaBenchmarkTasks( UBaseType_t uxPriority )
+{
+	/* The arena is created here, rather than by the task, so the chunk it
+	starts with is allocated before the heap becomes fragmented. */
+	xArena = xArenaCreate( ( size_t ) abARENA_CHUNK_SIZE, pdTRUE );
+
+	if( xArena != NULL )
+	{
+		xTaskCreate( prvArenaBenchmarkTask, "ArenaBm", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvArenaBenchmarkTask( void *pvParameters )
+{
+uint32_t ulRequest, ulHeapTime, ulArenaTime;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		for( ulRequest = 0; ulRequest < abREQUESTS_PER_CYCLE; ulRequest++ )
+		{
+			prvGenerateRequest();
+
+			ulHeapTime = prvRunRequestOnHeap();
+			ulArenaTime = prvRunRequestOnArena();
+
+			taskENTER_CRITICAL();
+			{
+				prvRecordTime( ulHeapTime, &ulWorstHeapTime, &ullTotalHeapTime );
+				prvRecordTime( ulArenaTime, &ulWorstArenaTime, &ullTotalArenaTime );
+				ulRequests++;
+			}
+			taskEXIT_CRITICAL();
+		}
+
+		vTaskDelay( abCYCLE_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvGenerateRequest( void )
+{
+UBaseType_t uxTokens, ux;
+
+	uxTokens = ( UBaseType_t ) ( ( prvRand() % abMAX_TOKENS ) + 1UL );
+	uxBlockCount = 0;
+
+	xBlockSizes[ uxBlockCount++ ] = ( size_t ) ( ( prvRand() % ( abMAX_RECEIVE_SIZE - abMIN_RECEIVE_SIZE ) ) + abMIN_RECEIVE_SIZE );
+
+	for( ux = 0; ux < uxTokens; ux++ )
+	{
+		xBlockSizes[ uxBlockCount++ ] = ( size_t ) ( ( prvRand() % abMAX_TOKEN_SIZE ) + 1UL );
+	}
+
+	xBlockSizes[ uxBlockCount++ ] = ( size_t ) ( ( prvRand() % abMAX_TABLE_SIZE ) + 1UL );
+	xBlockSizes[ uxBlockCount++ ] = ( size_t ) ( ( prvRand() % abMAX_RESPONSE_SIZE ) + 1UL );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRunRequestOnHeap( void )
+{
+UBaseType_t ux;
+uint32_t ulStart, ulElapsed = 0;
+
+	for( ux = 0; ux < uxBlockCount; ux++ )
+	{
+		vTaskSuspendAll();
+		{
+			ulStart = abGET_TIMESTAMP();
+			pucBlocks[ ux ] = ( uint8_t * ) pvPortMalloc( xBlockSizes[ ux ] );
+			ulElapsed += abGET_TIMESTAMP() - ulStart;
+		}
+		( void ) xTaskResumeAll();
+
+		prvFillBlock( ux );
+	}
+
+	for( ux = 0; ux < uxBlockCount; ux++ )
+	{
+		prvCheckBlock( ux );
+
+		vTaskSuspendAll();
+		{
+			ulStart = abGET_TIMESTAMP();
+			vPortFree( pucBlocks[ ux ] );
+			ulElapsed += abGET_TIMESTAMP() - ulStart;
+		}
+		( void ) xTaskResumeAll();
+
+		pucBlocks[ ux ] = NULL;
+	}
+
+	return ulElapsed;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRunRequestOnArena( void )
+{
+UBaseType_t ux;
+uint32_t ulStart, ulElapsed = 0;
+
+	for( ux = 0; ux < uxBlockCount; ux++ )
+	{
+		vTaskSuspendAll();
+		{
+			ulStart = abGET_TIMESTAMP();
+			pucBlocks[ ux ] = ( uint8_t * ) pvArenaAlloc( xArena, xBlockSizes[ ux ] );
+			ulElapsed += abGET_TIMESTAMP() - ulStart;
+		}
+		( void ) xTaskResumeAll();
+
+		prvFillBlock( ux );
+	}
+
+	for( ux = 0; ux < uxBlockCount; ux++ )
+	{
+		prvCheckBlock( ux );
+		pucBlocks[ ux ] = NULL;
+	}
+
+	vTaskSuspendAll();
+	{
+		ulStart = abGET_TIMESTAMP();
+		vArenaReset( xArena );
+		ulElapsed += abGET_TIMESTAMP() - ulStart;
+	}
+	( void ) xTaskResumeAll();
+
+	return ulElapsed;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFillBlock( UBaseType_t uxBlock )
+{
+size_t x;
+
+	if( pucBlocks[ uxBlock ] == NULL )
+	{
+		/* Not an error as the heap is shared with the other tasks, but the
+		figures are less meaningful if this happens often. */
+		ulAllocationFailures++;
+	}
+	else
+	{
+		if( ( ( size_t ) pucBlocks[ uxBlock ] & portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		for( x = 0; x < xBlockSizes[ uxBlock ]; x++ )
+		{
+			pucBlocks[ uxBlock ][ x ] = ( uint8_t ) uxBlock;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckBlock( UBaseType_t uxBlock )
+{
+size_t x;
+
+	if( pucBlocks[ uxBlock ] != NULL )
+	{
+		/* Another block overlapping this one would have changed its
+		contents. */
+		for( x = 0; x < xBlockSizes[ uxBlock ]; x++ )
+		{
+			if( pucBlocks[ uxBlock ][ x ] != ( uint8_t ) uxBlock )
+			{
+				xErrorStatus = pdFAIL;
+				break;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordTime( uint32_t ulElapsed, uint32_t *pulWorst, uint64_t *pullTotal )
+{
+	*pullTotal += ulElapsed;
+
+	if( ulElapsed > *pulWorst )
+	{
+		*pulWorst = ulElapsed;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( void )
+{
+	ulNextRand = ( ulNextRand * abRAND_MULTIPLIER ) + abRAND_INCREMENT;
+
+	/* The low bits of an LCG have short periods, so use the high bits. */
+	return ulNextRand >> 16UL;
+}
+/*-----------------------------------------------------------*/
+
+void vGetArenaBenchmarkResults( ArenaBenchmarkResults_t *pxResults )
+{
+	taskENTER_CRITICAL();
+	{
+		pxResults->ulWorstHeapRequestTime = ulWorstHeapTime;
+		pxResults->ulWorstArenaRequestTime = ulWorstArenaTime;
+		pxResults->ulAverageHeapRequestTime = ( ulRequests == 0 ) ? 0 : ( uint32_t ) ( ullTotalHeapTime / ulRequests );
+		pxResults->ulAverageArenaRequestTime = ( ulRequests == 0 ) ? 0 : ( uint32_t ) ( ullTotalArenaTime / ulRequests );
+		pxResults->ulRequests = ulRequests;
+		pxResults->ulAllocationFailures = ulAllocationFailures;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreArenaBenchmarkTasksStillRunning( void )
+{
+BaseType_t xReturn = xErrorStatus;
+
+	/* At least one request must have completed since the last call. */
+	if( ulRequests == ulLastRequests )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastRequests = ulRequests;
+
+	return xReturn;
+}
+
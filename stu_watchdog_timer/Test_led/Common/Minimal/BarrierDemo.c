@@ -0,0 +1,261 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the behaviour of barriers, and compares the time taken for a number of
+ * tasks to rendezvous using a barrier with the time taken for the same tasks to
+ * rendezvous using xEventGroupSync() in the way demonstrated by the sync tests
+ * in EventGroupsDemo.c.
+ *
+ * bdNUM_TASKS tasks are created.  Each periodically performs bdBENCHMARK_ROUNDS
+ * rendezvous using a barrier, then the same number using xEventGroupSync(),
+ * with each task setting its own bit in the event group.  The first task
+ * records the number of ticks taken by each, and the results can be obtained
+ * by calling vGetBarrierBenchmarkResults().
+ *
+ * Before each rendezvous a task increments its own arrival count.  After each
+ * rendezvous it checks that no other task is behind it (which would mean it
+ * was released before all the tasks arrived) or more than one round ahead of
+ * it (which would mean another task was released without waiting for it).
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_groups.h"
+#include "barrier.h"
+
+/* Demo program include files. */
+#include "BarrierDemo.h"
+
+/* The number of tasks that rendezvous. */
+#define bdNUM_TASKS				( 4 )
+
+/* The number of rendezvous performed by each half of the benchmark. */
+#define bdBENCHMARK_ROUNDS		( 1000UL )
+
+/* The time between each run of the benchmark. */
+#define bdBENCHMARK_PERIOD		pdMS_TO_TICKS( 1000UL )
+
+/* No rendezvous should take anywhere near this long. */
+#define bdMAX_WAIT				pdMS_TO_TICKS( 500UL )
+
+/* The event group bits used by the xEventGroupSync() half of the benchmark -
+one bit per task. */
+#define bdALL_SYNC_BITS			( ( EventBits_t ) ( ( 1UL << bdNUM_TASKS ) - 1UL ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvBarrierTask( void *pvParameters );
+
+/*
+ * Check the arrival counts of the other tasks after the calling task has
+ * completed the rendezvous numbered ulRound.
+ */
+static void prvCheckArrivals( uint32_t ulRound );
+
+/*-----------------------------------------------------------*/
+
+/* The barrier and event group the tasks rendezvous on. */
+static BarrierHandle_t xBarrier = NULL;
+static EventGroupHandle_t xEventGroup = NULL;
+
+/* The number of rendezvous each task has arrived at. */
+static volatile uint32_t ulArrivals[ bdNUM_TASKS ] = { 0 };
+
+/* Set to pdFAIL if any task finds an error. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* The result of the last run of the benchmark. */
+static volatile TickType_t xBarrierTicks = 0, xEventGroupSyncTicks = 0;
+
+/*-----------------------------------------------------------*/
+
+void vStartBarrierDemoTasks( UBaseType_t uxPriority )
+{
+UBaseType_t x;
+
+	xBarrier = xBarrierCreate( bdNUM_TASKS );
+	xEventGroup = xEventGroupCreate();
+
+	if( ( xBarrier != NULL ) && ( xEventGroup != NULL ) )
+	{
+		for( x = 0; x < bdNUM_TASKS; x++ )
+		{
+			xTaskCreate( prvBarrierTask, "Bar", configMINIMAL_STACK_SIZE, ( void * ) x, uxPriority, NULL );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBarrierTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) pvParameters;
+const EventBits_t uxSyncBit = ( EventBits_t ) ( 1UL << uxTask );
+EventBits_t uxReturned;
+TickType_t xStartTime = 0;
+uint32_t ul;
+
+	for( ;; )
+	{
+		/* Time the rendezvous using the barrier. */
+		if( uxTask == 0 )
+		{
+			xStartTime = xTaskGetTickCount();
+		}
+
+		for( ul = 0; ul < bdBENCHMARK_ROUNDS; ul++ )
+		{
+			ulArrivals[ uxTask ]++;
+
+			if( xBarrierWait( xBarrier, bdMAX_WAIT ) != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			prvCheckArrivals( ulArrivals[ uxTask ] );
+		}
+
+		if( uxTask == 0 )
+		{
+			xBarrierTicks = xTaskGetTickCount() - xStartTime;
+			xStartTime = xTaskGetTickCount();
+		}
+
+		/* Time the same number of rendezvous using the event group. */
+		for( ul = 0; ul < bdBENCHMARK_ROUNDS; ul++ )
+		{
+			ulArrivals[ uxTask ]++;
+
+			uxReturned = xEventGroupSync( xEventGroup, uxSyncBit, bdALL_SYNC_BITS, bdMAX_WAIT );
+
+			if( ( uxReturned & bdALL_SYNC_BITS ) != bdALL_SYNC_BITS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			prvCheckArrivals( ulArrivals[ uxTask ] );
+		}
+
+		if( uxTask == 0 )
+		{
+			xEventGroupSyncTicks = xTaskGetTickCount() - xStartTime;
+		}
+
+		/* The first rendezvous of the next run brings the tasks back into
+		step after the delay. */
+		vTaskDelay( bdBENCHMARK_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckArrivals( uint32_t ulRound )
+{
+UBaseType_t x;
+uint32_t ulOtherArrivals;
+
+	for( x = 0; x < bdNUM_TASKS; x++ )
+	{
+		ulOtherArrivals = ulArrivals[ x ];
+
+		if( ( ulOtherArrivals < ulRound ) || ( ulOtherArrivals > ( ulRound + 1UL ) ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vGetBarrierBenchmarkResults( TickType_t *pxBarrierTicks, TickType_t *pxEventGroupSyncTicks )
+{
+	*pxBarrierTicks = xBarrierTicks;
+	*pxEventGroupSyncTicks = xEventGroupSyncTicks;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreBarrierDemoTasksStillRunning( void )
+{
+static uint32_t ulLastArrivals = 0;
+BaseType_t xReturn = xErrorStatus;
+
+	if( ulArrivals[ 0 ] == ulLastArrivals )
+	{
+		/* The tasks have either stalled or discovered an error. */
+		xReturn = pdFAIL;
+	}
+
+	ulLastArrivals = ulArrivals[ 0 ];
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
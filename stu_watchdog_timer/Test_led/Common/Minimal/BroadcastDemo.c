@@ -0,0 +1,382 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the behaviour of broadcast channels.
+ *
+ * A publisher task publishes a sequence of items to a channel every
+ * bdPUBLISH_PERIOD, and vBroadcastPeriodicISRDemo() (which should be called
+ * from an interrupt such as the tick hook) publishes a second sequence to the
+ * same channel.  Items published by the interrupt have bdISR_SEQUENCE_BIT set
+ * in their sequence number so the two sequences can be told apart.  Each item
+ * also holds the inverse of its sequence number, so a corrupted item can be
+ * detected.
+ *
+ * bdNUM_FAST_SUBSCRIBERS subscriber tasks block on the channel, at a priority
+ * below the publisher, so every item published by the task unblocks all of
+ * them at once.  They check that each sequence is received in order, with no
+ * gaps that are not reported as lost items.
+ *
+ * A further, slow, subscriber only reads the channel every bdSLOW_READ_PERIOD,
+ * so falls behind and has items overwritten before it reads them.  It checks
+ * that the lost items are reported, and that the sequences still only move
+ * forward.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "broadcast.h"
+
+/* Demo program include files. */
+#include "BroadcastDemo.h"
+
+/* The number of subscribers that keep up with the publisher. */
+#define bdNUM_FAST_SUBSCRIBERS	( 3 )
+
+/* The number of items the channel can hold. */
+#define bdCHANNEL_LENGTH		( 4 )
+
+/* The time between each item published by the publisher task. */
+#define bdPUBLISH_PERIOD		pdMS_TO_TICKS( 5UL )
+
+/* The time the slow subscriber waits between each read. */
+#define bdSLOW_READ_PERIOD		pdMS_TO_TICKS( 50UL )
+
+/* The longest the fast subscribers wait for an item.  Much longer than the
+publish period, so timing out is an error. */
+#define bdRECEIVE_BLOCK_TIME	pdMS_TO_TICKS( 500UL )
+
+/* Items published by the interrupt have this bit set in their sequence
+number. */
+#define bdISR_SEQUENCE_BIT		( 0x80000000UL )
+
+/* The interrupt publishes an item every bdISR_PUBLISH_RATE calls to
+vBroadcastPeriodicISRDemo(). */
+#define bdISR_PUBLISH_RATE		( 7UL )
+
+/* A block time of 0 just means "don't block". */
+#define bdDONT_BLOCK			( 0 )
+
+/* The item published to the channel. */
+typedef struct BROADCAST_DEMO_ITEM
+{
+	uint32_t ulSequence;
+	uint32_t ulInverse;
+} BroadcastDemoItem_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvBroadcastPublisherTask( void *pvParameters );
+static void prvBroadcastFastSubscriberTask( void *pvParameters );
+static void prvBroadcastSlowSubscriberTask( void *pvParameters );
+
+/*
+ * Check an item that has been received, and that its sequence number follows
+ * the last item received from the same source, allowing for uxItemsLost items
+ * that were overwritten.  pulLastTaskSequence and pulLastISRSequence hold the
+ * last sequence numbers received from each source.
+ */
+static BaseType_t prvCheckItem( const BroadcastDemoItem_t *pxItem, UBaseType_t uxItemsLost, uint32_t *pulLastTaskSequence, uint32_t *pulLastISRSequence );
+
+/*-----------------------------------------------------------*/
+
+/* The channel used by all the tasks. */
+static BroadcastHandle_t xChannel = NULL;
+
+/* Incremented by each subscriber task each time it receives an item without
+finding an error.  The last element is used by the slow subscriber. */
+static volatile uint32_t ulSubscriberLoops[ bdNUM_FAST_SUBSCRIBERS + 1 ] = { 0 };
+
+/* The number of items the slow subscriber has been told it lost. */
+static volatile uint32_t ulSlowSubscriberItemsLost = 0;
+
+/* Set to pdFAIL if any task finds an error. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/*-----------------------------------------------------------*/
+
+void vStartBroadcastDemoTasks( UBaseType_t uxPriority )
+{
+UBaseType_t x;
+
+	xChannel = xBroadcastCreate( bdCHANNEL_LENGTH, ( UBaseType_t ) sizeof( BroadcastDemoItem_t ) );
+
+	if( xChannel != NULL )
+	{
+		/* The publisher runs above the subscribers, so they are all blocked
+		on the channel each time it publishes. */
+		xTaskCreate( prvBroadcastPublisherTask, "BCPub", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, NULL );
+
+		for( x = 0; x < bdNUM_FAST_SUBSCRIBERS; x++ )
+		{
+			xTaskCreate( prvBroadcastFastSubscriberTask, "BCSub", configMINIMAL_STACK_SIZE, ( void * ) x, uxPriority, NULL );
+		}
+
+		xTaskCreate( prvBroadcastSlowSubscriberTask, "BCSlow", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBroadcastPublisherTask( void *pvParameters )
+{
+BroadcastDemoItem_t xItem;
+uint32_t ulSequence = 0;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulSequence++;
+		xItem.ulSequence = ulSequence & ~bdISR_SEQUENCE_BIT;
+		xItem.ulInverse = ~( xItem.ulSequence );
+
+		vBroadcastPublish( xChannel, &xItem );
+
+		vTaskDelay( bdPUBLISH_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBroadcastFastSubscriberTask( void *pvParameters )
+{
+UBaseType_t uxSubscriber = ( UBaseType_t ) pvParameters;
+BroadcastSubscriberHandle_t xSubscriber;
+BroadcastDemoItem_t xItem;
+UBaseType_t uxItemsLost;
+uint32_t ulLastTaskSequence = 0, ulLastISRSequence = 0;
+
+	xSubscriber = xBroadcastSubscribe( xChannel );
+	configASSERT( xSubscriber );
+
+	for( ;; )
+	{
+		if( xBroadcastReceive( xSubscriber, &xItem, &uxItemsLost, bdRECEIVE_BLOCK_TIME ) != pdPASS )
+		{
+			/* Items are published far more often than the block time. */
+			xErrorStatus = pdFAIL;
+		}
+		else if( prvCheckItem( &xItem, uxItemsLost, &ulLastTaskSequence, &ulLastISRSequence ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else if( xErrorStatus == pdPASS )
+		{
+			ulSubscriberLoops[ uxSubscriber ]++;
+		}
+		else
+		{
+			/* An error has been found, so stop counting. */
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBroadcastSlowSubscriberTask( void *pvParameters )
+{
+BroadcastSubscriberHandle_t xSubscriber;
+BroadcastDemoItem_t xItem;
+UBaseType_t uxItemsLost;
+uint32_t ulLastTaskSequence = 0, ulLastISRSequence = 0;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	xSubscriber = xBroadcastSubscribe( xChannel );
+	configASSERT( xSubscriber );
+
+	for( ;; )
+	{
+		vTaskDelay( bdSLOW_READ_PERIOD );
+
+		/* Read everything that is still available. */
+		while( xBroadcastReceive( xSubscriber, &xItem, &uxItemsLost, bdDONT_BLOCK ) == pdPASS )
+		{
+			ulSlowSubscriberItemsLost += ( uint32_t ) uxItemsLost;
+
+			if( prvCheckItem( &xItem, uxItemsLost, &ulLastTaskSequence, &ulLastISRSequence ) != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+
+		/* More items may have been published since the last read, but the
+		number that can be read is never more than the channel holds. */
+		if( uxBroadcastItemsWaiting( xSubscriber ) > ( UBaseType_t ) bdCHANNEL_LENGTH )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( xErrorStatus == pdPASS )
+		{
+			ulSubscriberLoops[ bdNUM_FAST_SUBSCRIBERS ]++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vBroadcastPeriodicISRDemo( void )
+{
+static uint32_t ulCalls = 0, ulSequence = 0;
+BroadcastDemoItem_t xItem;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* This function should be called from an interrupt, such as the tick hook
+	function vApplicationTickHook(). */
+	ulCalls++;
+
+	if( ( xChannel != NULL ) && ( ( ulCalls % bdISR_PUBLISH_RATE ) == 0UL ) )
+	{
+		ulSequence++;
+		xItem.ulSequence = ulSequence | bdISR_SEQUENCE_BIT;
+		xItem.ulInverse = ~( xItem.ulSequence );
+
+		vBroadcastPublishFromISR( xChannel, &xItem, &xHigherPriorityTaskWoken );
+	}
+
+	/* The tick hook does not need to request a context switch as the tick
+	interrupt performs one if required. */
+	( void ) xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCheckItem( const BroadcastDemoItem_t *pxItem, UBaseType_t uxItemsLost, uint32_t *pulLastTaskSequence, uint32_t *pulLastISRSequence )
+{
+BaseType_t xReturn = pdPASS;
+uint32_t *pulLastSequence;
+
+	if( pxItem->ulInverse != ~( pxItem->ulSequence ) )
+	{
+		/* The item was corrupted. */
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( ( pxItem->ulSequence & bdISR_SEQUENCE_BIT ) != 0UL )
+		{
+			pulLastSequence = pulLastISRSequence;
+		}
+		else
+		{
+			pulLastSequence = pulLastTaskSequence;
+		}
+
+		/* Sequences only move forward.  The first item of each sequence can
+		follow any number of items published before the subscriber
+		subscribed. */
+		if( ( *pulLastSequence != 0UL ) && ( pxItem->ulSequence <= *pulLastSequence ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* If no items were lost then no item can have been skipped.  Items
+		lost may have come from either sequence, so a gap can be smaller than
+		the number lost. */
+		if( ( uxItemsLost == ( UBaseType_t ) 0 ) && ( *pulLastSequence != 0UL ) && ( pxItem->ulSequence != ( *pulLastSequence + 1UL ) ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		*pulLastSequence = pxItem->ulSequence;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreBroadcastDemoTasksStillRunning( void )
+{
+static uint32_t ulLastSubscriberLoops[ bdNUM_FAST_SUBSCRIBERS + 1 ] = { 0 };
+BaseType_t xReturn = xErrorStatus;
+UBaseType_t x;
+
+	for( x = 0; x < ( bdNUM_FAST_SUBSCRIBERS + 1 ); x++ )
+	{
+		if( ulSubscriberLoops[ x ] == ulLastSubscriberLoops[ x ] )
+		{
+			/* The subscriber has either stalled or discovered an error. */
+			xReturn = pdFAIL;
+		}
+
+		ulLastSubscriberLoops[ x ] = ulSubscriberLoops[ x ];
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulGetBroadcastDemoItemsLost( void )
+{
+	return ulSlowSubscriberItemsLost;
+}
+
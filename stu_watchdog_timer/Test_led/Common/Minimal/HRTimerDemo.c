@@ -0,0 +1,301 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the ordering and latency of high resolution timers.
+ *
+ * A control task repeatedly starts hrdNUM_TIMERS timers whose callbacks
+ * execute from the compare interrupt.  The timers are started in an order
+ * that differs from the order of their deadlines, with deadlines
+ * hrdSPACING_US apart.  Each callback records its timer's position in an
+ * array.  Once all the deadlines have passed the control task checks that
+ * every timer expired exactly once, and in deadline order.
+ *
+ * A further timer executes its callback from the high resolution timer service
+ * task, and notifies the control task, to test deferred callbacks.
+ *
+ * Each callback executed from the interrupt also checks it is no more than
+ * hrdMAX_ISR_LATENCY_US later than its deadline.  After each cycle the control
+ * task reads the latency statistics, which also include the deferred
+ * callback.  The worst latency seen can be obtained by calling
+ * vGetHRTimerDemoResults().
+ *
+ * Utils/HRTimerModel makes the same checks, and more, on a host computer
+ * against a model of the counter and compare registers.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hrtimer.h"
+
+/* Demo program include files. */
+#include "HRTimerDemo.h"
+
+/* The number of timers whose callbacks execute from the interrupt. */
+#define hrdNUM_TIMERS			( 8 )
+
+/* The time between consecutive deadlines. */
+#define hrdSPACING_US			( 50UL )
+
+/* The time between starting the timers and the first deadline. */
+#define hrdFIRST_DEADLINE_US	( 200UL )
+
+/* The latest that a callback executed from the interrupt should be. */
+#define hrdMAX_ISR_LATENCY_US	( 20UL )
+
+/* Long enough for every deadline in a cycle to have passed. */
+#define hrdCYCLE_DELAY			( pdMS_TO_TICKS( 2UL ) + ( TickType_t ) 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The control task described at the top of this file.
+ */
+static void prvHRTimerControlTask( void *pvParameters );
+
+/*
+ * The callbacks used by the two types of timer.
+ */
+static void prvISRTimerCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+static void prvTaskTimerCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*-----------------------------------------------------------*/
+
+static HRTimerHandle_t xISRTimers[ hrdNUM_TIMERS ] = { NULL };
+static HRTimerHandle_t xTaskTimer = NULL;
+static TaskHandle_t xControlTask = NULL;
+
+/* The deadline of each timer in the current cycle. */
+static volatile uint32_t ulDeadlines[ hrdNUM_TIMERS ];
+
+/* The position of each timer in its deadline order, in the order the
+callbacks actually executed. */
+static volatile UBaseType_t uxExpiryOrder[ hrdNUM_TIMERS ];
+static volatile UBaseType_t uxExpiries = 0;
+
+/* Set to pdFAIL if an error is found. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented each time a cycle completes without error. */
+static volatile uint32_t ulCycles = 0, ulLastCycles = 0;
+
+/* The worst latency seen, in microseconds. */
+static volatile uint32_t ulWorstLatencyUs = 0;
+
+/*-----------------------------------------------------------*/
+
+void vStartHRTimerDemoTasks( UBaseType_t uxPriority )
+{
+UBaseType_t x;
+
+	for( x = 0; x < hrdNUM_TIMERS; x++ )
+	{
+		xISRTimers[ x ] = xHRTimerCreate( "HRIsr", prvISRTimerCallback, ( void * ) x, hrtimerCALL_FROM_ISR );
+		configASSERT( xISRTimers[ x ] );
+	}
+
+	xTaskTimer = xHRTimerCreate( "HRTsk", prvTaskTimerCallback, NULL, hrtimerCALL_FROM_TASK );
+	configASSERT( xTaskTimer );
+
+	xTaskCreate( prvHRTimerControlTask, "HRCtl", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xControlTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHRTimerControlTask( void *pvParameters )
+{
+UBaseType_t x, uxTimer;
+uint32_t ulFirstDeadline;
+HRTimerStats_t xStats;
+
+	( void ) pvParameters;
+
+	/* Discard anything recorded before the test started. */
+	vHRTimerGetStats( &xStats, pdTRUE );
+
+	for( ;; )
+	{
+		uxExpiries = 0;
+		ulFirstDeadline = ulHRTimerGetCount() + hrtimerUS_TO_COUNTS( hrdFIRST_DEADLINE_US );
+
+		/* Start the timers in an order that is not the order of their
+		deadlines.  7 is co-prime to hrdNUM_TIMERS, so every timer is
+		started once. */
+		for( x = 0; x < hrdNUM_TIMERS; x++ )
+		{
+			uxTimer = ( x * 7 ) % hrdNUM_TIMERS;
+			ulDeadlines[ uxTimer ] = ulFirstDeadline + ( uxTimer * hrtimerUS_TO_COUNTS( hrdSPACING_US ) );
+			vHRTimerStartAt( xISRTimers[ uxTimer ], ulDeadlines[ uxTimer ] );
+		}
+
+		/* The deferred callback is due half way through. */
+		vHRTimerStartAt( xTaskTimer, ulFirstDeadline + ( ( hrdNUM_TIMERS / 2 ) * hrtimerUS_TO_COUNTS( hrdSPACING_US ) ) );
+
+		if( ulTaskNotifyTake( pdTRUE, hrdCYCLE_DELAY ) == 0 )
+		{
+			/* The deferred callback did not execute. */
+			xErrorStatus = pdFAIL;
+		}
+
+		vTaskDelay( hrdCYCLE_DELAY );
+
+		/* Every timer should have expired once, in deadline order. */
+		if( uxExpiries != hrdNUM_TIMERS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			for( x = 0; x < hrdNUM_TIMERS; x++ )
+			{
+				if( uxExpiryOrder[ x ] != x )
+				{
+					xErrorStatus = pdFAIL;
+				}
+
+				if( xHRTimerIsActive( xISRTimers[ x ] ) != pdFALSE )
+				{
+					xErrorStatus = pdFAIL;
+				}
+			}
+		}
+
+		vHRTimerGetStats( &xStats, pdTRUE );
+
+		if( ( xStats.ulMaxLatency / portHRTIMER_COUNTS_PER_US ) > ulWorstLatencyUs )
+		{
+			ulWorstLatencyUs = xStats.ulMaxLatency / portHRTIMER_COUNTS_PER_US;
+		}
+
+		if( xErrorStatus == pdPASS )
+		{
+			ulCycles++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvISRTimerCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+const UBaseType_t uxTimer = ( UBaseType_t ) pvHRTimerGetTimerID( xTimer );
+const uint32_t ulLatency = ulHRTimerGetCount() - ulDeadlines[ uxTimer ];
+
+	( void ) pxHigherPriorityTaskWoken;
+
+	/* A callback must never execute before its deadline, which would appear
+	as a very large latency, or too long after it. */
+	if( ulLatency > hrtimerUS_TO_COUNTS( hrdMAX_ISR_LATENCY_US ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( uxExpiries < hrdNUM_TIMERS )
+	{
+		uxExpiryOrder[ uxExpiries ] = uxTimer;
+	}
+
+	uxExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskTimerCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	( void ) xTimer;
+
+	/* Executed from the service task, so the parameter is not used. */
+	if( pxHigherPriorityTaskWoken != NULL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xTaskNotifyGive( xControlTask );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreHRTimerDemoTasksStillRunning( void )
+{
+BaseType_t xReturn = xErrorStatus;
+
+	/* The control task should have completed a cycle since the last call. */
+	if( ulCycles == ulLastCycles )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastCycles = ulCycles;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vGetHRTimerDemoResults( uint32_t *pulWorstLatencyUs )
+{
+	*pulWorstLatencyUs = ulWorstLatencyUs;
+}
+
@@ -0,0 +1,472 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the time taken by pvPortMalloc() and vPortFree() under a randomised
+ * allocation pattern, so the worst case timing of the heap implementation
+ * linked into the build can be compared against the others.
+ *
+ * A single task holds up to hbNUM_SLOTS blocks.  On each iteration it picks a
+ * slot at random.  If the slot holds a block then the block is checked and
+ * freed, otherwise a block of random size is allocated into it.  Most blocks
+ * are small, but one in hbLARGE_BLOCK_RATIO is up to hbMAX_LARGE_BLOCK_SIZE
+ * bytes, so the heap fragments over time.  Each allocated block is filled with
+ * a pattern unique to its slot, and the pattern is checked before the block is
+ * freed, to detect blocks that overlap.
+ *
+ * Each call is timed with the scheduler suspended so the measurement is not
+ * inflated by other tasks, although interrupts can still add to it.  After
+ * every hbITERATIONS_PER_CYCLE iterations the task frees all its blocks and
+ * delays for hbCYCLE_DELAY so it does not starve lower priority tasks.  The
+ * worst and average times can be obtained by calling
+ * vGetHeapBenchmarkResults().
+ *
+ * Before the blocks are freed at the end of cycle hbFRAGMENTATION_CYCLE the
+ * fragmentation of the heap is measured, as the percentage of the free heap
+ * space that cannot be obtained in a single allocation.  If hbUSE_HEAP_STATS
+ * is 1 the size of the largest free block is read from vPortGetHeapStats(),
+ * which only heap_4.c and heap_5.c provide.  Otherwise the largest block that
+ * can be allocated is found by a binary search of probe allocations, and the
+ * scheduler is resumed between probes so other tasks are not held off for the
+ * whole search.  A probe that succeeds can split a free block, which heap_2.c
+ * never combines again, so the search is only done once, after the heap has
+ * had time to fragment.  Many of the probe allocations fail, so the
+ * measurement is only made if hbMEASURE_FRAGMENTATION is 1, which by default
+ * it is only when configUSE_MALLOC_FAILED_HOOK is 0.
+ *
+ * The pseudo random sequence always starts from the same seed, so the same
+ * allocations are made whichever heap implementation is linked into the
+ * build, and the results of, for example, heap_2.c, heap_4.c and heap_7.c can
+ * be compared directly.
+ *
+ * Times are measured with hbGET_TIMESTAMP(), which uses the high resolution
+ * timer count when high resolution timers are in use, then the run time stats
+ * counter when run time stats are being generated, and otherwise the tick
+ * count.  The tick count is too coarse to be useful, so one of the others, or
+ * an application definition of hbGET_TIMESTAMP(), should be used.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo program include files. */
+#include "HeapBenchmark.h"
+
+#ifndef hbGET_TIMESTAMP
+	#if( configUSE_HRTIMERS == 1 )
+		#include "hrtimer.h"
+		#define hbGET_TIMESTAMP()	ulHRTimerGetCount()
+	#elif( configGENERATE_RUN_TIME_STATS == 1 )
+		#define hbGET_TIMESTAMP()	( ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() )
+	#else
+		#define hbGET_TIMESTAMP()	( ( uint32_t ) xTaskGetTickCount() )
+	#endif
+#endif
+
+#ifndef hbMEASURE_FRAGMENTATION
+	#if( configUSE_MALLOC_FAILED_HOOK == 0 )
+		#define hbMEASURE_FRAGMENTATION	1
+	#else
+		#define hbMEASURE_FRAGMENTATION	0
+	#endif
+#endif
+
+/* Options that only heap_4.c and heap_5.c accept show vPortGetHeapStats() is
+available.  Define hbUSE_HEAP_STATS to 1 to use it when either is built without
+them. */
+#ifndef hbUSE_HEAP_STATS
+	#if( ( configUSE_HEAP_SLABS == 1 ) || ( configUSE_HEAP_ACCOUNTING == 1 ) || ( configUSE_HEAP_CANARIES == 1 ) || ( configUSE_HEAP_ISR_CACHE == 1 ) || ( configUSE_HEAP_REGION_CLASSES == 1 ) )
+		#define hbUSE_HEAP_STATS	1
+	#else
+		#define hbUSE_HEAP_STATS	0
+	#endif
+#endif
+
+/* The cycle at the end of which fragmentation is measured. */
+#define hbFRAGMENTATION_CYCLE		( 100UL )
+
+/* The maximum number of blocks held at once. */
+#define hbNUM_SLOTS					( 24 )
+
+/* Sizes of the blocks that are allocated. */
+#define hbMAX_SMALL_BLOCK_SIZE		( 64UL )
+#define hbMAX_LARGE_BLOCK_SIZE		( 512UL )
+#define hbLARGE_BLOCK_RATIO			( 8UL )
+
+/* The number of iterations between freeing every block and delaying. */
+#define hbITERATIONS_PER_CYCLE		( 500UL )
+#define hbCYCLE_DELAY				( pdMS_TO_TICKS( 20UL ) + ( TickType_t ) 1 )
+
+/* Constants used by the pseudo random number generator. */
+#define hbRAND_MULTIPLIER			( 1664525UL )
+#define hbRAND_INCREMENT			( 1013904223UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task described at the top of this file.
+ */
+static void prvHeapBenchmarkTask( void *pvParameters );
+
+/*
+ * Allocate a block into, or check and free the block held in, slot uxSlot.
+ */
+static void prvAllocateSlot( UBaseType_t uxSlot );
+static void prvFreeSlot( UBaseType_t uxSlot );
+
+#if( hbMEASURE_FRAGMENTATION == 1 )
+
+	/*
+	 * Measure, and record, the fragmentation of the heap.
+	 */
+	static void prvMeasureFragmentation( void );
+
+#endif
+
+/*
+ * A linear congruential generator - the sequence only needs to be
+ * repeatable, not good.
+ */
+static uint32_t prvRand( void );
+
+/*-----------------------------------------------------------*/
+
+static uint8_t *pucBlocks[ hbNUM_SLOTS ] = { NULL };
+static size_t xBlockSizes[ hbNUM_SLOTS ] = { 0 };
+
+static uint32_t ulNextRand = 0x12345678UL;
+
+/* The timing results. */
+static volatile uint32_t ulWorstMallocTime = 0, ulWorstFreeTime = 0;
+static uint64_t ullTotalMallocTime = 0, ullTotalFreeTime = 0;
+static uint32_t ulMallocCalls = 0, ulFreeCalls = 0;
+static volatile uint32_t ulMallocFailures = 0;
+static volatile uint32_t ulFragmentation = 0;
+
+/* Set to pdFAIL if an error is found. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented each time a cycle completes. */
+static volatile uint32_t ulCycles = 0, ulLastCycles = 0;
+
+/*-----------------------------------------------------------*/
+
+void vStartHeapBenchmarkTasks( UBaseType_t uxPriority )
+{
+	xTaskCreate( prvHeapBenchmarkTask, "HeapBm", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapBenchmarkTask( void *pvParameters )
+{
+uint32_t ulIteration;
+UBaseType_t uxSlot;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		for( ulIteration = 0; ulIteration < hbITERATIONS_PER_CYCLE; ulIteration++ )
+		{
+			uxSlot = ( UBaseType_t ) ( prvRand() % ( uint32_t ) hbNUM_SLOTS );
+
+			if( pucBlocks[ uxSlot ] == NULL )
+			{
+				prvAllocateSlot( uxSlot );
+			}
+			else
+			{
+				prvFreeSlot( uxSlot );
+			}
+		}
+
+		#if( hbMEASURE_FRAGMENTATION == 1 )
+		{
+			if( ulCycles == hbFRAGMENTATION_CYCLE )
+			{
+				prvMeasureFragmentation();
+			}
+		}
+		#endif
+
+		/* Return everything to the heap before letting other tasks run. */
+		for( uxSlot = 0; uxSlot < hbNUM_SLOTS; uxSlot++ )
+		{
+			if( pucBlocks[ uxSlot ] != NULL )
+			{
+				prvFreeSlot( uxSlot );
+			}
+		}
+
+		ulCycles++;
+		vTaskDelay( hbCYCLE_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvAllocateSlot( UBaseType_t uxSlot )
+{
+size_t xSize, x;
+uint32_t ulStart, ulElapsed;
+uint8_t *pucBlock;
+
+	if( ( prvRand() % hbLARGE_BLOCK_RATIO ) == 0 )
+	{
+		xSize = ( size_t ) ( ( prvRand() % hbMAX_LARGE_BLOCK_SIZE ) + 1UL );
+	}
+	else
+	{
+		xSize = ( size_t ) ( ( prvRand() % hbMAX_SMALL_BLOCK_SIZE ) + 1UL );
+	}
+
+	vTaskSuspendAll();
+	{
+		ulStart = hbGET_TIMESTAMP();
+		pucBlock = ( uint8_t * ) pvPortMalloc( xSize );
+		ulElapsed = hbGET_TIMESTAMP() - ulStart;
+	}
+	( void ) xTaskResumeAll();
+
+	ullTotalMallocTime += ulElapsed;
+	ulMallocCalls++;
+
+	if( ulElapsed > ulWorstMallocTime )
+	{
+		ulWorstMallocTime = ulElapsed;
+	}
+
+	if( pucBlock == NULL )
+	{
+		/* Not an error as the heap is shared with the other tasks, but the
+		figures are less meaningful if this happens often. */
+		ulMallocFailures++;
+	}
+	else
+	{
+		if( ( ( size_t ) pucBlock & portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		for( x = 0; x < xSize; x++ )
+		{
+			pucBlock[ x ] = ( uint8_t ) uxSlot;
+		}
+
+		pucBlocks[ uxSlot ] = pucBlock;
+		xBlockSizes[ uxSlot ] = xSize;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFreeSlot( UBaseType_t uxSlot )
+{
+size_t x;
+uint32_t ulStart, ulElapsed;
+
+	/* Another block overlapping this one would have changed its contents. */
+	for( x = 0; x < xBlockSizes[ uxSlot ]; x++ )
+	{
+		if( pucBlocks[ uxSlot ][ x ] != ( uint8_t ) uxSlot )
+		{
+			xErrorStatus = pdFAIL;
+			break;
+		}
+	}
+
+	vTaskSuspendAll();
+	{
+		ulStart = hbGET_TIMESTAMP();
+		vPortFree( pucBlocks[ uxSlot ] );
+		ulElapsed = hbGET_TIMESTAMP() - ulStart;
+	}
+	( void ) xTaskResumeAll();
+
+	ullTotalFreeTime += ulElapsed;
+	ulFreeCalls++;
+
+	if( ulElapsed > ulWorstFreeTime )
+	{
+		ulWorstFreeTime = ulElapsed;
+	}
+
+	pucBlocks[ uxSlot ] = NULL;
+	xBlockSizes[ uxSlot ] = 0;
+}
+/*-----------------------------------------------------------*/
+
+#if( hbMEASURE_FRAGMENTATION == 1 )
+
+	static void prvMeasureFragmentation( void )
+	{
+	size_t xFreeBytes, xLargest;
+
+		#if( hbUSE_HEAP_STATS == 1 )
+		{
+		HeapStats_t xHeapStats;
+
+			/* The size of the largest free block includes its header, so a
+			heap that is not fragmented at all reads as 0. */
+			vPortGetHeapStats( &xHeapStats );
+			xFreeBytes = xHeapStats.xAvailableHeapSpaceInBytes;
+			xLargest = xHeapStats.xSizeOfLargestFreeBlockInBytes;
+		}
+		#else
+		{
+		size_t xHigh, xTry;
+		void *pvBlock;
+
+			xFreeBytes = xPortGetFreeHeapSize();
+
+			/* Every heap rounds requests up to the byte alignment, so a
+			binary search in steps of the alignment finds the exact size of
+			the largest block that can be allocated.  xLargest can always be
+			allocated, and xHigh never can. */
+			xLargest = 0;
+			xHigh = ( xFreeBytes & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) + ( size_t ) portBYTE_ALIGNMENT;
+
+			while( ( xHigh - xLargest ) > ( size_t ) portBYTE_ALIGNMENT )
+			{
+				xTry = ( xLargest + ( ( xHigh - xLargest ) / ( size_t ) 2 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+				/* Other tasks must not see the heap while the probe holds
+				what may be most of it, but can run between probes. */
+				vTaskSuspendAll();
+				{
+					pvBlock = pvPortMalloc( xTry );
+
+					if( pvBlock != NULL )
+					{
+						vPortFree( pvBlock );
+						xLargest = xTry;
+					}
+					else
+					{
+						xHigh = xTry;
+					}
+				}
+				( void ) xTaskResumeAll();
+			}
+		}
+		#endif /* hbUSE_HEAP_STATS */
+
+		/* Other tasks can have allocated some of the free space since it was
+		read. */
+		if( ( xFreeBytes != ( size_t ) 0 ) && ( xLargest <= xFreeBytes ) )
+		{
+			/* The size of an allocated block does not include its header, so
+			when probing the figure is never quite 0. */
+			ulFragmentation = ( uint32_t ) ( ( ( uint64_t ) ( xFreeBytes - xLargest ) * 100ULL ) / ( uint64_t ) xFreeBytes );
+		}
+	}
+
+#endif /* hbMEASURE_FRAGMENTATION */
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( void )
+{
+	ulNextRand = ( ulNextRand * hbRAND_MULTIPLIER ) + hbRAND_INCREMENT;
+
+	/* The low bits of an LCG have short periods, so use the high bits. */
+	return ulNextRand >> 16UL;
+}
+/*-----------------------------------------------------------*/
+
+void vGetHeapBenchmarkResults( HeapBenchmarkResults_t *pxResults )
+{
+	taskENTER_CRITICAL();
+	{
+		pxResults->ulWorstMallocTime = ulWorstMallocTime;
+		pxResults->ulWorstFreeTime = ulWorstFreeTime;
+		pxResults->ulAverageMallocTime = ( ulMallocCalls == 0 ) ? 0 : ( uint32_t ) ( ullTotalMallocTime / ulMallocCalls );
+		pxResults->ulAverageFreeTime = ( ulFreeCalls == 0 ) ? 0 : ( uint32_t ) ( ullTotalFreeTime / ulFreeCalls );
+		pxResults->ulMallocCalls = ulMallocCalls;
+		pxResults->ulMallocFailures = ulMallocFailures;
+		pxResults->ulFragmentation = ulFragmentation;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreHeapBenchmarkTasksStillRunning( void )
+{
+BaseType_t xReturn = xErrorStatus;
+
+	/* The task must have completed at least one cycle since the last call. */
+	if( ulCycles == ulLastCycles )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastCycles = ulCycles;
+
+	return xReturn;
+}
+
@@ -0,0 +1,252 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Records each call to pvPortMalloc() and vPortFree() in a ring buffer of
+ * htBUFFER_RECORDS records, each of which is 12 bytes.  When the buffer is
+ * full the oldest record is overwritten.  See HeapTrace.h for how to connect
+ * the recorder to the traceMALLOC_REQUESTED() and traceFREE() macros.
+ *
+ * vHeapTraceDump() writes a header followed by the records currently in the
+ * buffer, oldest first, then empties the buffer.  It passes the data to a
+ * function provided by the application - normally one that writes to a UART.
+ * Calls made while a dump is in progress are not recorded, as the write
+ * function might itself allocate memory.  The header records the number of
+ * the first record, so a host can join consecutive dumps together and detect
+ * any records that were lost in between.
+ *
+ * Records can be added from tasks and interrupts.  Timestamps are taken with
+ * htGET_TIMESTAMP(), which is selected in the same way as hbGET_TIMESTAMP() in
+ * HeapBenchmark.c.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo program include files. */
+#include "HeapTrace.h"
+
+#ifndef htGET_TIMESTAMP
+	#if( configUSE_HRTIMERS == 1 )
+		#include "hrtimer.h"
+		#define htGET_TIMESTAMP()	ulHRTimerGetCount()
+	#elif( configGENERATE_RUN_TIME_STATS == 1 )
+		#define htGET_TIMESTAMP()	( ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() )
+	#else
+		#define htGET_TIMESTAMP()	( ( uint32_t ) xTaskGetTickCount() )
+	#endif
+#endif
+
+/* The number of records held in the ring buffer. */
+#ifndef htBUFFER_RECORDS
+	#define htBUFFER_RECORDS		( 256 )
+#endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add a record to the buffer, overwriting the oldest record if the buffer is
+ * full.
+ */
+static void prvAddRecord( void *pvAddress, size_t xSize, uint32_t ulFlags );
+
+/*-----------------------------------------------------------*/
+
+static HeapTraceRecord_t xRecords[ htBUFFER_RECORDS ];
+
+/* The position and number of the oldest record in the buffer, and the number
+of records in the buffer. */
+static UBaseType_t uxOldestRecord = 0;
+static uint32_t ulOldestRecordNumber = 0;
+static UBaseType_t uxRecordCount = 0;
+
+/* The number given to the next call, whether or not it is recorded. */
+static uint32_t ulNextRecordNumber = 0;
+
+/* pdTRUE while vHeapTraceDump() is writing out the buffer. */
+static volatile BaseType_t xDumpInProgress = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vHeapTraceRecordMalloc( void *pvAddress, size_t xSize )
+{
+	prvAddRecord( pvAddress, xSize, 0UL );
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceRecordFree( void *pvAddress, size_t xSize )
+{
+	prvAddRecord( pvAddress, xSize, htRECORD_FREE_BIT );
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRecord( void *pvAddress, size_t xSize, uint32_t ulFlags )
+{
+HeapTraceRecord_t *pxRecord;
+UBaseType_t uxSavedInterruptStatus;
+
+	#if( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) )
+	{
+		ulFlags |= ( ( uint32_t ) uxTaskGetTaskNumber( xTaskGetCurrentTaskHandle() ) & htRECORD_TASK_MASK ) << htRECORD_TASK_SHIFT;
+	}
+	#endif
+
+	if( xSize > ( size_t ) htRECORD_SIZE_MASK )
+	{
+		xSize = ( size_t ) htRECORD_SIZE_MASK;
+	}
+
+	/* Records can be added from interrupts, and while the scheduler is
+	suspended. */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( xDumpInProgress == pdFALSE )
+		{
+			if( uxRecordCount == ( UBaseType_t ) htBUFFER_RECORDS )
+			{
+				/* Overwrite the oldest record. */
+				uxOldestRecord++;
+				if( uxOldestRecord == ( UBaseType_t ) htBUFFER_RECORDS )
+				{
+					uxOldestRecord = 0;
+				}
+
+				ulOldestRecordNumber++;
+				uxRecordCount--;
+			}
+			else if( uxRecordCount == 0 )
+			{
+				/* Records made while the last dump was in progress were not
+				kept, so the numbers restart from this record. */
+				ulOldestRecordNumber = ulNextRecordNumber;
+			}
+
+			pxRecord = &( xRecords[ ( uxOldestRecord + uxRecordCount ) % ( UBaseType_t ) htBUFFER_RECORDS ] );
+			pxRecord->ulTimestamp = htGET_TIMESTAMP();
+			pxRecord->ulAddress = ( uint32_t ) ( portPOINTER_SIZE_TYPE ) pvAddress;
+			pxRecord->ulSizeAndTask = ( uint32_t ) xSize | ulFlags;
+			uxRecordCount++;
+		}
+
+		ulNextRecordNumber++;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceDump( HeapTraceWriteFunction_t pxWriteFunction )
+{
+HeapTraceDumpHeader_t xHeader;
+UBaseType_t uxOldest, uxCount, uxFirstPart;
+
+	/* Stop records being added so the buffer does not change while it is
+	written out, which can take some time. */
+	taskENTER_CRITICAL();
+	{
+		xDumpInProgress = pdTRUE;
+		uxOldest = uxOldestRecord;
+		uxCount = uxRecordCount;
+		xHeader.ulFirstRecordNumber = ulOldestRecordNumber;
+	}
+	taskEXIT_CRITICAL();
+
+	xHeader.ulMagic = htDUMP_MAGIC;
+	xHeader.usVersion = htDUMP_VERSION;
+	xHeader.usRecordSize = ( uint16_t ) sizeof( HeapTraceRecord_t );
+	xHeader.ulRecordCount = ( uint32_t ) uxCount;
+	pxWriteFunction( &xHeader, sizeof( xHeader ) );
+
+	/* The records wrap around the end of the buffer. */
+	uxFirstPart = ( UBaseType_t ) htBUFFER_RECORDS - uxOldest;
+
+	if( uxFirstPart > uxCount )
+	{
+		uxFirstPart = uxCount;
+	}
+
+	if( uxFirstPart > 0 )
+	{
+		pxWriteFunction( &( xRecords[ uxOldest ] ), ( size_t ) uxFirstPart * sizeof( HeapTraceRecord_t ) );
+	}
+
+	if( uxCount > uxFirstPart )
+	{
+		pxWriteFunction( &( xRecords[ 0 ] ), ( size_t ) ( uxCount - uxFirstPart ) * sizeof( HeapTraceRecord_t ) );
+	}
+
+	taskENTER_CRITICAL();
+	{
+		uxOldestRecord = 0;
+		uxRecordCount = 0;
+		xDumpInProgress = pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+}
+
@@ -0,0 +1,355 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the behaviour of mailboxes, and compares the time taken to read the
+ * latest value of some shared state using a mailbox with the time taken to read
+ * the same state using the xQueueOverwrite()/xQueuePeek() pattern demonstrated
+ * in QueueOverwrite.c.
+ *
+ * A writer task, and vMailboxPeriodicISRDemo() (which should be called from an
+ * interrupt such as the tick hook), repeatedly write a value into both a
+ * mailbox and a queue of length one.  Each value is a structure in which every
+ * member is derived from the same count, so a torn read can be detected.
+ *
+ * Two reader tasks continuously read the mailbox and check that every value
+ * read is consistent and that the version number returned by uxMailboxRead()
+ * never goes backwards.
+ *
+ * A benchmark task periodically reads the mailbox mbBENCHMARK_READS times and
+ * then peeks the queue mbBENCHMARK_READS times, recording the number of ticks
+ * taken by each.  The results can be obtained by calling
+ * vGetMailboxBenchmarkResults().
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "mailbox.h"
+
+/* Demo program include files. */
+#include "MailboxDemo.h"
+
+/* The number of reader tasks that are created. */
+#define mbNUM_READERS			( 2 )
+
+/* The number of reads performed by each half of the benchmark. */
+#define mbBENCHMARK_READS		( 20000UL )
+
+/* The time between each run of the benchmark. */
+#define mbBENCHMARK_PERIOD		pdMS_TO_TICKS( 1000UL )
+
+/* The time between each write performed by the writer task. */
+#define mbWRITE_PERIOD			pdMS_TO_TICKS( 2UL )
+
+/* Values written by the ISR have this bit set in their count, so values
+written by the ISR and the task are distinguishable. */
+#define mbISR_COUNT_BIT			( 0x80000000UL )
+
+/* A block time of 0 just means "don't block". */
+#define mbDONT_BLOCK			( 0 )
+
+/* The value held in both the mailbox and the queue. */
+typedef struct MAILBOX_DEMO_VALUE
+{
+	uint32_t ulCount;
+	uint32_t ulInverse;
+	uint32_t ulDouble;
+	uint32_t ulXor;
+} MailboxDemoValue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvMailboxWriterTask( void *pvParameters );
+static void prvMailboxReaderTask( void *pvParameters );
+static void prvMailboxBenchmarkTask( void *pvParameters );
+
+/*
+ * Fill in a value from a count, and check that a value read back was filled in
+ * in the same way.
+ */
+static void prvFillValue( MailboxDemoValue_t *pxValue, uint32_t ulCount );
+static BaseType_t prvCheckValue( const MailboxDemoValue_t *pxValue );
+
+/*-----------------------------------------------------------*/
+
+/* The mailbox and queue that hold the same state. */
+static MailboxHandle_t xMailbox = NULL;
+static QueueHandle_t xQueue = NULL;
+
+/* Incremented by each reader task each time it completes a loop without
+finding an error. */
+static volatile uint32_t ulReaderLoops[ mbNUM_READERS ] = { 0 };
+
+/* Set to pdFAIL if any task or the ISR finds an error. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* The result of the last run of the benchmark. */
+static volatile TickType_t xMailboxReadTicks = 0, xQueuePeekTicks = 0;
+
+/*-----------------------------------------------------------*/
+
+void vStartMailboxDemoTasks( UBaseType_t uxPriority )
+{
+UBaseType_t x;
+
+	xMailbox = xMailboxCreate( ( UBaseType_t ) sizeof( MailboxDemoValue_t ) );
+	xQueue = xQueueCreate( 1, ( UBaseType_t ) sizeof( MailboxDemoValue_t ) );
+
+	if( ( xMailbox != NULL ) && ( xQueue != NULL ) )
+	{
+		/* The writer runs above the readers so it preempts them part way
+		through their reads, which exercises the retry path. */
+		xTaskCreate( prvMailboxWriterTask, "MBWr", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, NULL );
+
+		for( x = 0; x < mbNUM_READERS; x++ )
+		{
+			xTaskCreate( prvMailboxReaderTask, "MBRd", configMINIMAL_STACK_SIZE, ( void * ) x, uxPriority, NULL );
+		}
+
+		/* The benchmark also runs above the readers so its timings are not
+		shared with them. */
+		xTaskCreate( prvMailboxBenchmarkTask, "MBBen", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMailboxWriterTask( void *pvParameters )
+{
+MailboxDemoValue_t xValue;
+uint32_t ulCount = 0;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulCount++;
+		prvFillValue( &xValue, ulCount & ~mbISR_COUNT_BIT );
+
+		vMailboxWrite( xMailbox, &xValue );
+		xQueueOverwrite( xQueue, &xValue );
+
+		vTaskDelay( mbWRITE_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMailboxReaderTask( void *pvParameters )
+{
+UBaseType_t uxReader = ( UBaseType_t ) pvParameters;
+UBaseType_t uxVersion, uxLastVersion = 0;
+MailboxDemoValue_t xValue;
+
+	for( ;; )
+	{
+		uxVersion = uxMailboxRead( xMailbox, &xValue );
+
+		if( uxVersion < uxLastVersion )
+		{
+			/* The version number should never go backwards. */
+			xErrorStatus = pdFAIL;
+		}
+
+		if( ( uxVersion != 0 ) && ( prvCheckValue( &xValue ) != pdPASS ) )
+		{
+			/* The read was torn. */
+			xErrorStatus = pdFAIL;
+		}
+
+		uxLastVersion = uxVersion;
+
+		if( xErrorStatus == pdPASS )
+		{
+			ulReaderLoops[ uxReader ]++;
+		}
+
+		#if( configUSE_PREEMPTION == 0 )
+			taskYIELD();
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMailboxBenchmarkTask( void *pvParameters )
+{
+MailboxDemoValue_t xValue;
+TickType_t xStartTime;
+uint32_t ul;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		vTaskDelay( mbBENCHMARK_PERIOD );
+
+		/* Time reads of the latest value using the mailbox. */
+		xStartTime = xTaskGetTickCount();
+		for( ul = 0; ul < mbBENCHMARK_READS; ul++ )
+		{
+			( void ) uxMailboxRead( xMailbox, &xValue );
+		}
+		xMailboxReadTicks = xTaskGetTickCount() - xStartTime;
+
+		if( prvCheckValue( &xValue ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* Time reads of the same value using the queue.  The queue is only
+		empty before the writer has run for the first time. */
+		xStartTime = xTaskGetTickCount();
+		for( ul = 0; ul < mbBENCHMARK_READS; ul++ )
+		{
+			( void ) xQueuePeek( xQueue, &xValue, mbDONT_BLOCK );
+		}
+		xQueuePeekTicks = xTaskGetTickCount() - xStartTime;
+
+		if( prvCheckValue( &xValue ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vMailboxPeriodicISRDemo( void )
+{
+static uint32_t ulCount = 0;
+MailboxDemoValue_t xValue;
+
+	/* This function should be called from an interrupt, such as the tick hook
+	function vApplicationTickHook(). */
+	if( xMailbox != NULL )
+	{
+		ulCount++;
+		prvFillValue( &xValue, ulCount | mbISR_COUNT_BIT );
+		vMailboxWriteFromISR( xMailbox, &xValue );
+		( void ) xQueueOverwriteFromISR( xQueue, &xValue, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFillValue( MailboxDemoValue_t *pxValue, uint32_t ulCount )
+{
+	pxValue->ulCount = ulCount;
+	pxValue->ulInverse = ~ulCount;
+	pxValue->ulDouble = ulCount << 1UL;
+	pxValue->ulXor = ulCount ^ 0xa5a5a5a5UL;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCheckValue( const MailboxDemoValue_t *pxValue )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( ( pxValue->ulInverse != ~( pxValue->ulCount ) ) ||
+		( pxValue->ulDouble != ( pxValue->ulCount << 1UL ) ) ||
+		( pxValue->ulXor != ( pxValue->ulCount ^ 0xa5a5a5a5UL ) ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vGetMailboxBenchmarkResults( TickType_t *pxMailboxReadTicks, TickType_t *pxQueuePeekTicks )
+{
+	*pxMailboxReadTicks = xMailboxReadTicks;
+	*pxQueuePeekTicks = xQueuePeekTicks;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreMailboxDemoTasksStillRunning( void )
+{
+static uint32_t ulLastReaderLoops[ mbNUM_READERS ] = { 0 };
+BaseType_t xReturn = xErrorStatus;
+UBaseType_t x;
+
+	for( x = 0; x < mbNUM_READERS; x++ )
+	{
+		if( ulReaderLoops[ x ] == ulLastReaderLoops[ x ] )
+		{
+			/* The reader has either stalled or discovered an error. */
+			xReturn = pdFAIL;
+		}
+
+		ulLastReaderLoops[ x ] = ulReaderLoops[ x ];
+	}
+
+	return xReturn;
+}
+
+
@@ -0,0 +1,927 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A host model of the registers behind the portHRTIMER_ macros, used to test
+ * the ordering and latency of the high resolution timers in hrtimer.c without
+ * target hardware.
+ *
+ * The model provides a free running 32-bit counter, a compare register, the
+ * compare interrupt flag and enable, and an interrupt mask.  Time only passes
+ * when the code under test reads the counter, when a callback does some work,
+ * or when the model's idle loop runs, so every run with the same seed is
+ * identical.  Each read of the counter costs modelREAD_COST counts, plus an
+ * occasional stall of up to modelMAX_STALL_COUNTS.  A pending compare
+ * interrupt is taken at the next read of the counter, or the next tick of the
+ * idle loop, at which interrupts are not masked.  Entering the interrupt takes
+ * up to modelMAX_ENTRY_COUNTS.  The counter starts just below its overflow, so
+ * the first deadlines straddle the wrap.
+ *
+ * Three tests are run:
+ *
+ *  + Ordering.  modelNUM_TIMERS timers, whose callbacks execute from the
+ *    interrupt, are started in a random order with random deadlines, many of
+ *    which are equal and some of which have already passed.  Some are then
+ *    restarted or stopped.  Each timer that is still running must expire
+ *    exactly once, in deadline order, with timers that have equal deadlines
+ *    expiring in the order they were started.
+ *
+ *  + Periodic.  A timer restarts itself from its callback, each deadline
+ *    exactly modelPERIOD_COUNTS after the last, while a second timer restarts
+ *    itself at random intervals.  Every period must expire exactly once.
+ *
+ *  + Deferred.  Timers whose callbacks execute from the service task must
+ *    have their callbacks executed in expiry order, and two expiries of the
+ *    same timer before the service task runs must be merged.  The service
+ *    task is the real task function from hrtimer.c, which returns to the
+ *    model when ulTaskNotifyTake() would block.
+ *
+ * Every callback executed from the interrupt must start no more than
+ * modelLATENCY_BOUND counts after the latest of its deadline, the end of the
+ * previous callback, and the end of the last critical section entered by the
+ * model.  The mean and worst latency, and the jitter, are reported, along
+ * with the statistics from vHRTimerGetStats().
+ *
+ * hrtimer.c is included into this file.  From the directory that contains
+ * this file:
+ *
+ *	gcc -O2 -I. -I../../../../Source/include HRTimerModel.c -o HRTimerModel
+ *
+ * Then run, optionally giving a random seed:
+ *
+ *	./HRTimerModel [seed]
+ *
+ * The program exits with EXIT_FAILURE if any check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+
+/* FreeRTOS includes - the host versions of FreeRTOSConfig.h and portmacro.h
+are in the same directory as this file. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hrtimer.h"
+
+/* The implementation under test. */
+#include "../../../../Source/hrtimer.c"
+
+/* Costs of the modelled operations, in counts. */
+#define modelREAD_COST			( 1UL )
+#define modelMAX_STALL_COUNTS	( 8UL )
+#define modelMAX_ENTRY_COUNTS	( 12UL )
+#define modelMAX_CALLBACK_COUNTS	( 20UL )
+
+/* The latest a callback executed from the interrupt may start.  Allows for the
+interrupt entry and a few stalled reads of the counter in the handler. */
+#define modelLATENCY_BOUND		( modelMAX_ENTRY_COUNTS + ( 4UL * ( modelREAD_COST + modelMAX_STALL_COUNTS ) ) )
+
+/* The count at which the model starts. */
+#define modelINITIAL_COUNT		( 0xfffff000UL )
+
+/* Parameters of the ordering test. */
+#define modelNUM_TIMERS			( 16 )
+#define modelORDERING_ROUNDS	( 2000UL )
+#define modelDEADLINE_STEP		( 25UL )
+#define modelDEADLINE_STEPS		( 64UL )
+
+/* Parameters of the periodic test. */
+#define modelPERIOD_COUNTS		( 500UL )
+#define modelPERIODS			( 5000UL )
+
+/* Parameters of the deferred test. */
+#define modelNUM_TASK_TIMERS	( 4 )
+#define modelDEFERRED_ROUNDS	( 500UL )
+
+/* The longest the idle loop runs waiting for expected expiries. */
+#define modelIDLE_TIMEOUT		( 200000UL )
+
+/* Only the first few errors are printed. */
+#define modelMAX_ERRORS_PRINTED	( 10UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The three tests described at the top of this file.
+ */
+static void prvTestOrdering( void );
+static void prvTestPeriodic( void );
+static void prvTestDeferred( void );
+
+/*
+ * The callbacks used by the tests.
+ */
+static void prvOrderingCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+static void prvPeriodicCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+static void prvBackgroundCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+static void prvDeferredCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*
+ * Check the latency of a callback executed from the interrupt with deadline
+ * ulDeadline, and add it to the results.  Called at the start of the callback.
+ */
+static void prvCheckLatency( uint32_t ulDeadline );
+
+/*
+ * Called at the end of a callback executed from the interrupt.  Does
+ * a random amount of work first.
+ */
+static void prvEndCallback( void );
+
+/*
+ * Let time pass, with interrupts unmasked, for ulCounts counts, or until
+ * *pulDone reaches ulTarget if pulDone is not NULL.
+ */
+static void prvIdle( uint32_t ulCounts, volatile uint32_t *pulDone, uint32_t ulTarget );
+
+/*
+ * Advance the counter, setting the compare interrupt flag if the counter
+ * passes through the compare value.
+ */
+static void prvAdvance( uint32_t ulCounts );
+
+/*
+ * Take the compare interrupt if it is pending, enabled and not masked.
+ */
+static void prvCheckInterrupt( void );
+
+/*
+ * Run the service task until it would block.
+ */
+static void prvRunServiceTask( void );
+
+/*
+ * Record a failed check.
+ */
+static void prvError( const char *pcMessage, uint32_t ulValue );
+
+/*
+ * A small pseudo random number generator, so runs can be repeated.
+ */
+static uint32_t prvRandom( void );
+
+/*-----------------------------------------------------------*/
+
+/* The registers. */
+static uint32_t ulCount = modelINITIAL_COUNT;
+static uint32_t ulCompare = 0UL;
+static BaseType_t xInterruptEnabled = pdFALSE;
+static BaseType_t xInterruptPending = pdFALSE;
+
+/* The interrupt mask, and the critical section nesting at task level. */
+static UBaseType_t uxInterruptMask = 0;
+static UBaseType_t uxCriticalNesting = 0;
+static BaseType_t xInInterrupt = pdFALSE;
+
+/* Used for the latency checks. */
+static uint32_t ulLastUnmasked = modelINITIAL_COUNT;
+static uint32_t ulLastCallbackEnd = modelINITIAL_COUNT;
+
+/* The service task. */
+static TaskFunction_t pxServiceTaskCode = NULL;
+static uint32_t ulServiceTaskNotifications = 0UL;
+static jmp_buf xServiceTaskBlocked;
+
+/* The state of the ordering test. */
+static HRTimerHandle_t xOrderingTimers[ modelNUM_TIMERS ];
+static uint32_t ulOrderingDeadlines[ modelNUM_TIMERS ];
+static uint32_t ulStartSequence[ modelNUM_TIMERS ];
+static uint32_t ulExpiriesExpected[ modelNUM_TIMERS ];
+static uint32_t ulExpiriesSeen[ modelNUM_TIMERS ];
+static UBaseType_t uxExpiryOrder[ modelNUM_TIMERS * 2 ];
+static volatile uint32_t ulExpiries = 0UL;
+
+/* The state of the periodic test. */
+static uint32_t ulPeriodicDeadline = 0UL;
+static volatile uint32_t ulPeriodsSeen = 0UL;
+static uint32_t ulBackgroundDeadline = 0UL;
+
+/* The state of the deferred test. */
+static HRTimerHandle_t xDeferredTimers[ modelNUM_TASK_TIMERS ];
+static UBaseType_t uxDeferredOrder[ modelNUM_TASK_TIMERS * 2 ];
+static uint32_t ulDeferredCallbacks = 0UL;
+
+/* Results. */
+static uint32_t ulErrors = 0UL;
+static uint32_t ulInterrupts = 0UL;
+static uint32_t ulLatencySamples = 0UL;
+static uint64_t ullTotalLatency = 0ULL;
+static uint32_t ulMaxLatency = 0UL;
+static uint32_t ulMinLatency = 0xffffffffUL;
+static uint32_t ulRandomState = 0x2545f491UL;
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+HRTimerStats_t xStats;
+
+	if( argc > 1 )
+	{
+		ulRandomState = ( uint32_t ) strtoul( argv[ 1 ], NULL, 0 );
+
+		if( ulRandomState == 0UL )
+		{
+			/* The generator cannot use 0. */
+			ulRandomState = 1UL;
+		}
+	}
+
+	( void ) xHRTimerServiceStart();
+
+	prvTestOrdering();
+	prvTestPeriodic();
+	prvTestDeferred();
+
+	vHRTimerGetStats( &xStats, pdFALSE );
+
+	printf( "Interrupts taken:           %lu\n", ( unsigned long ) ulInterrupts );
+	printf( "Callbacks checked:          %lu\n", ( unsigned long ) ulLatencySamples );
+	printf( "Latency mean/worst:         %lu/%lu counts (bound %lu)\n", ( ulLatencySamples == 0UL ) ? 0UL : ( unsigned long ) ( ullTotalLatency / ulLatencySamples ), ( unsigned long ) ulMaxLatency, ( unsigned long ) modelLATENCY_BOUND );
+	printf( "Jitter:                     %lu counts\n", ( ulLatencySamples == 0UL ) ? 0UL : ( unsigned long ) ( ulMaxLatency - ulMinLatency ) );
+	printf( "vHRTimerGetStats() expiries/worst: %lu/%lu counts\n", ( unsigned long ) xStats.ulExpiries, ( unsigned long ) xStats.ulMaxLatency );
+	printf( "Errors:                     %lu\n", ( unsigned long ) ulErrors );
+
+	return ( ulErrors == 0UL ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestOrdering( void )
+{
+uint32_t ulRound, ulBase, ulSequence = 0UL, ulExpected, ulPosition;
+UBaseType_t x, y, uxTimer, uxPermutation[ modelNUM_TIMERS ], uxSorted[ modelNUM_TIMERS ];
+int32_t lKeyX, lKeyY;
+
+	for( x = 0; x < modelNUM_TIMERS; x++ )
+	{
+		xOrderingTimers[ x ] = xHRTimerCreate( "Order", prvOrderingCallback, ( void * ) x, hrtimerCALL_FROM_ISR );
+		configASSERT( xOrderingTimers[ x ] );
+	}
+
+	for( ulRound = 0UL; ulRound < modelORDERING_ROUNDS; ulRound++ )
+	{
+		/* Start the timers in a random order. */
+		for( x = 0; x < modelNUM_TIMERS; x++ )
+		{
+			uxPermutation[ x ] = x;
+			ulExpiriesSeen[ x ] = 0UL;
+		}
+
+		for( x = modelNUM_TIMERS - 1; x > 0; x-- )
+		{
+			y = ( UBaseType_t ) ( prvRandom() % ( uint32_t ) ( x + 1 ) );
+			uxTimer = uxPermutation[ x ];
+			uxPermutation[ x ] = uxPermutation[ y ];
+			uxPermutation[ y ] = uxTimer;
+		}
+
+		ulExpiries = 0UL;
+
+		/* All the timers are started from one critical section, so none
+		expire until they have all been started.  The earliest deadlines will
+		have passed by then. */
+		taskENTER_CRITICAL();
+		{
+			ulBase = ulCount;
+
+			for( x = 0; x < modelNUM_TIMERS; x++ )
+			{
+				uxTimer = uxPermutation[ x ];
+				ulOrderingDeadlines[ uxTimer ] = ulBase + ( ( prvRandom() % modelDEADLINE_STEPS ) * modelDEADLINE_STEP );
+				ulStartSequence[ uxTimer ] = ulSequence++;
+				ulExpiriesExpected[ uxTimer ] = 1UL;
+				vHRTimerStartAt( xOrderingTimers[ uxTimer ], ulOrderingDeadlines[ uxTimer ] );
+			}
+
+			/* Restart or stop some of them. */
+			for( x = 0; x < modelNUM_TIMERS; x++ )
+			{
+				switch( prvRandom() % 8UL )
+				{
+					case 0 :
+					case 1 :
+						ulOrderingDeadlines[ x ] = ulBase + ( ( prvRandom() % modelDEADLINE_STEPS ) * modelDEADLINE_STEP );
+						ulStartSequence[ x ] = ulSequence++;
+						vHRTimerStartAt( xOrderingTimers[ x ], ulOrderingDeadlines[ x ] );
+						break;
+
+					case 2 :
+						ulExpiriesExpected[ x ] = 0UL;
+						vHRTimerStop( xOrderingTimers[ x ] );
+						break;
+
+					default :
+						break;
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		ulExpected = 0UL;
+		for( x = 0; x < modelNUM_TIMERS; x++ )
+		{
+			ulExpected += ulExpiriesExpected[ x ];
+		}
+
+		/* Wait for the expected expiries, then a while longer to catch any
+		that should not happen. */
+		prvIdle( modelIDLE_TIMEOUT, &ulExpiries, ulExpected );
+		prvIdle( modelDEADLINE_STEP * modelDEADLINE_STEPS, NULL, 0UL );
+
+		if( ulExpiries != ulExpected )
+		{
+			prvError( "Ordering: wrong number of expiries in round", ulRound );
+		}
+
+		/* Sort the timers that should have expired by deadline, then start
+		order.  An insertion sort is stable. */
+		ulPosition = 0UL;
+		for( x = 0; x < modelNUM_TIMERS; x++ )
+		{
+			if( ulExpiriesSeen[ x ] != ulExpiriesExpected[ x ] )
+			{
+				prvError( "Ordering: timer expired the wrong number of times", ( uint32_t ) x );
+			}
+
+			if( ulExpiriesExpected[ x ] != 0UL )
+			{
+				lKeyX = ( int32_t ) ( ulOrderingDeadlines[ x ] - ulBase );
+				y = ( UBaseType_t ) ulPosition;
+
+				while( y > 0 )
+				{
+					lKeyY = ( int32_t ) ( ulOrderingDeadlines[ uxSorted[ y - 1 ] ] - ulBase );
+
+					if( ( lKeyY > lKeyX ) || ( ( lKeyY == lKeyX ) && ( ulStartSequence[ uxSorted[ y - 1 ] ] > ulStartSequence[ x ] ) ) )
+					{
+						uxSorted[ y ] = uxSorted[ y - 1 ];
+						y--;
+					}
+					else
+					{
+						break;
+					}
+				}
+
+				uxSorted[ y ] = x;
+				ulPosition++;
+			}
+		}
+
+		if( ulExpiries == ulExpected )
+		{
+			for( ulPosition = 0UL; ulPosition < ulExpected; ulPosition++ )
+			{
+				if( uxExpiryOrder[ ulPosition ] != uxSorted[ ulPosition ] )
+				{
+					prvError( "Ordering: timers expired out of order in round", ulRound );
+					break;
+				}
+			}
+		}
+	}
+
+	printf( "Ordering:                   %lu rounds of %d timers\n", ( unsigned long ) modelORDERING_ROUNDS, modelNUM_TIMERS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvOrderingCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxTimer = ( UBaseType_t ) pvHRTimerGetTimerID( xTimer );
+
+	( void ) pxHigherPriorityTaskWoken;
+
+	prvCheckLatency( ulOrderingDeadlines[ uxTimer ] );
+
+	if( ulExpiries < ( uint32_t ) ( modelNUM_TIMERS * 2 ) )
+	{
+		uxExpiryOrder[ ulExpiries ] = uxTimer;
+	}
+
+	( ulExpiriesSeen[ uxTimer ] )++;
+	ulExpiries++;
+
+	prvEndCallback();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPeriodic( void )
+{
+HRTimerHandle_t xPeriodicTimer, xBackgroundTimer;
+
+	xPeriodicTimer = xHRTimerCreate( "Period", prvPeriodicCallback, NULL, hrtimerCALL_FROM_ISR );
+	xBackgroundTimer = xHRTimerCreate( "Backgnd", prvBackgroundCallback, NULL, hrtimerCALL_FROM_ISR );
+	configASSERT( xPeriodicTimer );
+	configASSERT( xBackgroundTimer );
+
+	ulPeriodsSeen = 0UL;
+
+	taskENTER_CRITICAL();
+	{
+		ulPeriodicDeadline = ulCount + modelPERIOD_COUNTS;
+		ulBackgroundDeadline = ulCount + ( prvRandom() % modelPERIOD_COUNTS );
+		vHRTimerStartAt( xPeriodicTimer, ulPeriodicDeadline );
+		vHRTimerStartAt( xBackgroundTimer, ulBackgroundDeadline );
+	}
+	taskEXIT_CRITICAL();
+
+	prvIdle( modelPERIOD_COUNTS * ( modelPERIODS + 2UL ), &ulPeriodsSeen, modelPERIODS );
+
+	vHRTimerStop( xPeriodicTimer );
+	vHRTimerStop( xBackgroundTimer );
+
+	if( ulPeriodsSeen != modelPERIODS )
+	{
+		prvError( "Periodic: periods seen", ulPeriodsSeen );
+	}
+
+	vHRTimerDelete( xPeriodicTimer );
+	vHRTimerDelete( xBackgroundTimer );
+
+	printf( "Periodic:                   %lu periods of %lu counts\n", ( unsigned long ) modelPERIODS, ( unsigned long ) modelPERIOD_COUNTS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	( void ) pxHigherPriorityTaskWoken;
+
+	prvCheckLatency( ulPeriodicDeadline );
+
+	if( hrtimerIS_BEFORE( ulCount, ulPeriodicDeadline ) != pdFALSE )
+	{
+		prvError( "Periodic: callback before its deadline", ulPeriodsSeen );
+	}
+
+	ulPeriodsSeen++;
+
+	if( ulPeriodsSeen < modelPERIODS )
+	{
+		/* Restart relative to the deadline, not the current count, so the
+		period does not drift. */
+		ulPeriodicDeadline += modelPERIOD_COUNTS;
+		vHRTimerStartAtFromISR( xTimer, ulPeriodicDeadline );
+	}
+
+	prvEndCallback();
+}
+/*-----------------------------------------------------------*/
+
+static void prvBackgroundCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	( void ) pxHigherPriorityTaskWoken;
+
+	prvCheckLatency( ulBackgroundDeadline );
+
+	ulBackgroundDeadline += ( prvRandom() % modelPERIOD_COUNTS ) + 1UL;
+	vHRTimerStartAtFromISR( xTimer, ulBackgroundDeadline );
+
+	prvEndCallback();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestDeferred( void )
+{
+uint32_t ulRound, ulBase, ulNotifications;
+UBaseType_t x;
+
+	for( x = 0; x < modelNUM_TASK_TIMERS; x++ )
+	{
+		xDeferredTimers[ x ] = xHRTimerCreate( "Defer", prvDeferredCallback, ( void * ) x, hrtimerCALL_FROM_TASK );
+		configASSERT( xDeferredTimers[ x ] );
+	}
+
+	for( ulRound = 0UL; ulRound < modelDEFERRED_ROUNDS; ulRound++ )
+	{
+		ulDeferredCallbacks = 0UL;
+		ulNotifications = ulServiceTaskNotifications;
+
+		/* Start the timers in reverse order of their deadlines, so the
+		callbacks must be reordered. */
+		taskENTER_CRITICAL();
+		{
+			ulBase = ulCount + modelLATENCY_BOUND;
+
+			for( x = 0; x < modelNUM_TASK_TIMERS; x++ )
+			{
+				vHRTimerStartAt( xDeferredTimers[ x ], ulBase + ( ( uint32_t ) ( modelNUM_TASK_TIMERS - x ) * modelDEADLINE_STEP ) );
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		prvIdle( modelDEADLINE_STEP * ( modelNUM_TASK_TIMERS + 2UL ), NULL, 0UL );
+
+		/* Timer 0 expires again before the service task runs, so its two
+		expiries are merged into one callback. */
+		vHRTimerStart( xDeferredTimers[ 0 ], 1UL );
+		prvIdle( modelDEADLINE_STEP * 4UL, NULL, 0UL );
+
+		if( ulServiceTaskNotifications == ulNotifications )
+		{
+			prvError( "Deferred: service task not notified in round", ulRound );
+		}
+
+		prvRunServiceTask();
+
+		if( ulDeferredCallbacks != ( uint32_t ) modelNUM_TASK_TIMERS )
+		{
+			prvError( "Deferred: wrong number of callbacks in round", ulRound );
+		}
+		else
+		{
+			for( x = 0; x < modelNUM_TASK_TIMERS; x++ )
+			{
+				if( uxDeferredOrder[ x ] != ( modelNUM_TASK_TIMERS - 1 - x ) )
+				{
+					prvError( "Deferred: callbacks out of order in round", ulRound );
+					break;
+				}
+			}
+		}
+	}
+
+	printf( "Deferred:                   %lu rounds of %d timers\n", ( unsigned long ) modelDEFERRED_ROUNDS, modelNUM_TASK_TIMERS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeferredCallback( HRTimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	if( pxHigherPriorityTaskWoken != NULL )
+	{
+		prvError( "Deferred: callback executed from the interrupt", 0UL );
+	}
+
+	if( xInInterrupt != pdFALSE )
+	{
+		prvError( "Deferred: callback executed in interrupt context", 0UL );
+	}
+
+	if( ulDeferredCallbacks < ( uint32_t ) ( modelNUM_TASK_TIMERS * 2 ) )
+	{
+		uxDeferredOrder[ ulDeferredCallbacks ] = ( UBaseType_t ) pvHRTimerGetTimerID( xTimer );
+	}
+
+	ulDeferredCallbacks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckLatency( uint32_t ulDeadline )
+{
+uint32_t ulReference = ulDeadline, ulLatency;
+
+	if( xInInterrupt == pdFALSE )
+	{
+		prvError( "Callback executed outside the interrupt", 0UL );
+	}
+
+	if( hrtimerIS_BEFORE( ulCount, ulDeadline ) != pdFALSE )
+	{
+		prvError( "Callback executed before its deadline", ulDeadline );
+	}
+
+	/* A callback cannot start before the previous callback has finished, or
+	while the model had interrupts masked. */
+	if( hrtimerIS_BEFORE( ulReference, ulLastCallbackEnd ) != pdFALSE )
+	{
+		ulReference = ulLastCallbackEnd;
+	}
+
+	if( hrtimerIS_BEFORE( ulReference, ulLastUnmasked ) != pdFALSE )
+	{
+		ulReference = ulLastUnmasked;
+	}
+
+	ulLatency = ulCount - ulReference;
+
+	if( ulLatency > modelLATENCY_BOUND )
+	{
+		prvError( "Callback latency exceeded the bound", ulLatency );
+	}
+
+	ulLatencySamples++;
+	ullTotalLatency += ulLatency;
+
+	if( ulLatency > ulMaxLatency )
+	{
+		ulMaxLatency = ulLatency;
+	}
+
+	if( ulLatency < ulMinLatency )
+	{
+		ulMinLatency = ulLatency;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEndCallback( void )
+{
+	prvAdvance( prvRandom() % ( modelMAX_CALLBACK_COUNTS + 1UL ) );
+	ulLastCallbackEnd = ulCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvIdle( uint32_t ulCounts, volatile uint32_t *pulDone, uint32_t ulTarget )
+{
+uint32_t ulElapsed;
+
+	for( ulElapsed = 0UL; ulElapsed < ulCounts; ulElapsed++ )
+	{
+		if( ( pulDone != NULL ) && ( *pulDone >= ulTarget ) )
+		{
+			break;
+		}
+
+		prvAdvance( 1UL );
+		prvCheckInterrupt();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvAdvance( uint32_t ulCounts )
+{
+	/* The compare matches when the counter becomes equal to it. */
+	if( ( ulCompare - ulCount - 1UL ) < ulCounts )
+	{
+		xInterruptPending = pdTRUE;
+	}
+
+	ulCount += ulCounts;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckInterrupt( void )
+{
+	while( ( xInterruptPending != pdFALSE ) && ( xInterruptEnabled != pdFALSE ) && ( uxInterruptMask == 0 ) && ( xInInterrupt == pdFALSE ) )
+	{
+		prvAdvance( prvRandom() % ( modelMAX_ENTRY_COUNTS + 1UL ) );
+
+		ulInterrupts++;
+		xInInterrupt = pdTRUE;
+		vHRTimerInterruptHandler();
+		xInInterrupt = pdFALSE;
+
+		/* The handler must leave the interrupt unmasked, and must have either
+		reprogrammed or disabled the compare. */
+		configASSERT( uxInterruptMask == 0 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunServiceTask( void )
+{
+	configASSERT( pxServiceTaskCode );
+
+	if( setjmp( xServiceTaskBlocked ) == 0 )
+	{
+		pxServiceTaskCode( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvError( const char *pcMessage, uint32_t ulValue )
+{
+	if( ulErrors < modelMAX_ERRORS_PRINTED )
+	{
+		fprintf( stderr, "%s (%lu) at count 0x%08lx\n", pcMessage, ( unsigned long ) ulValue, ( unsigned long ) ulCount );
+	}
+
+	ulErrors++;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+	ulRandomState ^= ulRandomState << 13;
+	ulRandomState ^= ulRandomState >> 17;
+	ulRandomState ^= ulRandomState << 5;
+
+	return ulRandomState;
+}
+/*-----------------------------------------------------------*/
+
+/* The register model, used through the portHRTIMER_ and interrupt mask macros
+in portmacro.h. */
+
+uint32_t ulModelReadCount( void )
+{
+uint32_t ulReturn;
+
+	prvAdvance( modelREAD_COST );
+
+	if( ( prvRandom() % 16UL ) == 0UL )
+	{
+		prvAdvance( prvRandom() % ( modelMAX_STALL_COUNTS + 1UL ) );
+	}
+
+	ulReturn = ulCount;
+
+	/* An interrupt can be taken after the read completes. */
+	prvCheckInterrupt();
+
+	return ulReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vModelSetup( void )
+{
+	xInterruptEnabled = pdFALSE;
+	xInterruptPending = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vModelSetCompare( uint32_t ulNewCompare )
+{
+	ulCompare = ulNewCompare;
+	xInterruptPending = pdFALSE;
+	xInterruptEnabled = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vModelDisableCompare( void )
+{
+	xInterruptEnabled = pdFALSE;
+	xInterruptPending = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vModelForceInterrupt( void )
+{
+	xInterruptPending = pdTRUE;
+	xInterruptEnabled = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vModelEnterCritical( void )
+{
+	configASSERT( xInInterrupt == pdFALSE );
+	uxInterruptMask = 1;
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vModelExitCritical( void )
+{
+	configASSERT( uxCriticalNesting > 0 );
+	uxCriticalNesting--;
+
+	if( uxCriticalNesting == 0 )
+	{
+		uxInterruptMask = 0;
+		ulLastUnmasked = ulCount;
+		prvCheckInterrupt();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxModelSetInterruptMask( void )
+{
+UBaseType_t uxReturn = uxInterruptMask;
+
+	uxInterruptMask = 1;
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vModelClearInterruptMask( UBaseType_t uxSavedStatus )
+{
+	uxInterruptMask = uxSavedStatus;
+
+	if( uxInterruptMask == 0 )
+	{
+		prvCheckInterrupt();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* The kernel functions used by hrtimer.c. */
+
+BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions )
+{
+	( void ) pcName;
+	( void ) usStackDepth;
+	( void ) pvParameters;
+	( void ) uxPriority;
+	( void ) puxStackBuffer;
+	( void ) xRegions;
+
+	pxServiceTaskCode = pxTaskCode;
+
+	if( pxCreatedTask != NULL )
+	{
+		*pxCreatedTask = ( TaskHandle_t ) &pxServiceTaskCode;
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	configASSERT( xTaskToNotify == ( TaskHandle_t ) &pxServiceTaskCode );
+	configASSERT( xInInterrupt != pdFALSE );
+
+	ulServiceTaskNotifications++;
+	*pxHigherPriorityTaskWoken = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+{
+static uint32_t ulTaken = 0UL;
+uint32_t ulReturn;
+
+	configASSERT( xClearCountOnExit != pdFALSE );
+	( void ) xTicksToWait;
+
+	if( ulTaken == ulServiceTaskNotifications )
+	{
+		/* The service task would block, so return to the model. */
+		longjmp( xServiceTaskBlocked, 1 );
+	}
+
+	ulReturn = ulServiceTaskNotifications - ulTaken;
+	ulTaken = ulServiceTaskNotifications;
+
+	return ulReturn;
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+	return malloc( xWantedSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+	free( pv );
+}
+
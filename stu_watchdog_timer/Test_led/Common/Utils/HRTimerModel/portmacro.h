@@ -0,0 +1,139 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+/*-----------------------------------------------------------
+ * Port definitions used to build HRTimerModel.c on a host computer.  The
+ * interrupt mask, the counter and the compare channel are all provided by the
+ * register model in HRTimerModel.c.
+ *----------------------------------------------------------*/
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	uintptr_t
+#define portBASE_TYPE	long
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+
+/* Pointers can be wider than 32 bits on a host. */
+#define portPOINTER_SIZE_TYPE	uintptr_t
+
+/* Architecture specifics. */
+#define portBYTE_ALIGNMENT		8
+#define portSTACK_GROWTH		( -1 )
+#define portTICK_PERIOD_MS		( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+
+/* Interrupt mask, implemented by the model. */
+void vModelEnterCritical( void );
+void vModelExitCritical( void );
+UBaseType_t uxModelSetInterruptMask( void );
+void vModelClearInterruptMask( UBaseType_t uxSavedStatus );
+
+/* Critical section and interrupt management. */
+#define portENTER_CRITICAL()					vModelEnterCritical()
+#define portEXIT_CRITICAL()						vModelExitCritical()
+#define portDISABLE_INTERRUPTS()				( void ) uxModelSetInterruptMask()
+#define portENABLE_INTERRUPTS()					vModelClearInterruptMask( 0 )
+#define portSET_INTERRUPT_MASK_FROM_ISR()		uxModelSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vModelClearInterruptMask( x )
+#define portYIELD()
+#define portEND_SWITCHING_ISR( xSwitchRequired ) ( void ) ( xSwitchRequired )
+#define portNOP()
+
+/* High resolution timer registers, implemented by the model.  The counts per
+microsecond match a PIC32MX core timer with a 40MHz CPU clock. */
+uint32_t ulModelReadCount( void );
+void vModelSetup( void );
+void vModelSetCompare( uint32_t ulCompare );
+void vModelDisableCompare( void );
+void vModelForceInterrupt( void );
+#define portHRTIMER_GET_COUNT()				ulModelReadCount()
+#define portHRTIMER_COUNTS_PER_US			( 20UL )
+#define portHRTIMER_MIN_COUNTS				( 2UL * portHRTIMER_COUNTS_PER_US )
+#define portHRTIMER_SETUP()					vModelSetup()
+#define portHRTIMER_SET_COMPARE( ulCount )	vModelSetCompare( ulCount )
+#define portHRTIMER_DISABLE_COMPARE()		vModelDisableCompare()
+#define portHRTIMER_FORCE_INTERRUPT()		vModelForceInterrupt()
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+
+#endif /* PORTMACRO_H */
+
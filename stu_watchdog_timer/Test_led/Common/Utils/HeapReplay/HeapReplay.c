@@ -0,0 +1,697 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Replays allocation traces captured by Minimal/HeapTrace.c through one of
+ * the FreeRTOS heap implementations on a host computer, and reports how well
+ * the implementation handled the workload:
+ *
+ *  + the number of allocations that failed during the replay, although they
+ *    succeeded on the target;
+ *  + the peak number of bytes the application had allocated, and the peak
+ *    number of bytes the heap needed to provide them;
+ *  + the fragmentation of the heap at the end of the trace, as the percentage
+ *    of the free heap space that cannot be obtained in a single allocation;
+ *  + the mean and worst time taken by pvPortMalloc() and vPortFree().  Times
+ *    are host times, so are only meaningful relative to each other.
+ *
+ * For heap_4.c and heap_5.c the number of free blocks reported by
+ * vPortGetHeapStats() is also checked against a walk of the free list, and the
+ * program fails if they differ.
+ *
+ * The heap implementation is included into this file, so one program is built
+ * for each implementation, selected by its number with REPLAY_HEAP.  From the
+ * directory that contains this file:
+ *
+ *	gcc -O2 -I. -I../../include -I../../../../Source/include -DREPLAY_HEAP=4 HeapReplay.c -o HeapReplay_heap_4
+ *
+ * heap_1.c cannot be used, as it does not free memory, and neither can
+ * heap_3.c, as it only wraps the C library malloc() and free() so has no free
+ * heap size to measure.  heap_5.c and heap_6.c are defined with
+ * vPortDefineHeapRegions(), and -DREPLAY_HEAP_REGIONS=2 splits the heap into
+ * two regions with a gap between them.  The heap size can be set to match the
+ * target with -DconfigTOTAL_HEAP_SIZE=n.  Then run, for example:
+ *
+ *	./HeapReplay_heap_4 trace.bin
+ *
+ * A trace file holds one or more dumps written by vHeapTraceDump(), in the
+ * order they were made.  More than one file can be given.  Records lost
+ * between dumps are reported, and frees of blocks whose allocation was lost
+ * are skipped.  Allocations that failed on the target are skipped too, as the
+ * application never freed them.
+ *
+ * The sizes in a trace are those the application passed to pvPortMalloc(), as
+ * recorded through traceMALLOC_REQUESTED(), so they do not depend on the heap
+ * implementation used on the target.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* FreeRTOS includes - the host versions of FreeRTOSConfig.h and portmacro.h
+are in the same directory as this file. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo program include files. */
+#include "HeapTrace.h"
+
+#ifndef REPLAY_HEAP
+	#define REPLAY_HEAP 4
+#endif
+
+#if( ( REPLAY_HEAP == 1 ) || ( REPLAY_HEAP == 3 ) )
+	#error heap_1.c does not free memory, and heap_3.c does not provide xPortGetFreeHeapSize(), so neither can be replayed.
+#elif( ( REPLAY_HEAP < 2 ) || ( REPLAY_HEAP > 7 ) )
+	#error REPLAY_HEAP must be the number of one of the heap implementations in Source/portable/MemMang.
+#endif
+
+/* heap_5.c and heap_6.c have no heap of their own until regions are added. */
+#if( ( REPLAY_HEAP == 5 ) || ( REPLAY_HEAP == 6 ) )
+	#define REPLAY_USE_HEAP_REGIONS 1
+#else
+	#define REPLAY_USE_HEAP_REGIONS 0
+#endif
+
+/* The number of regions the heap is split into when REPLAY_USE_HEAP_REGIONS is
+1, either 1 or 2. */
+#ifndef REPLAY_HEAP_REGIONS
+	#define REPLAY_HEAP_REGIONS 1
+#endif
+
+#if( ( REPLAY_HEAP_REGIONS != 1 ) && ( ( REPLAY_USE_HEAP_REGIONS == 0 ) || ( REPLAY_HEAP_REGIONS != 2 ) ) )
+	#error REPLAY_HEAP_REGIONS can only be 2 when heap_5.c or heap_6.c is replayed.
+#endif
+
+/* The bytes left unused between two regions. */
+#define replayREGION_GAP	( 64 )
+
+/* heap_4.c and heap_5.c provide vPortGetHeapStats(). */
+#if( ( REPLAY_HEAP == 4 ) || ( REPLAY_HEAP == 5 ) )
+	#define REPLAY_CHECK_HEAP_STATS 1
+#else
+	#define REPLAY_CHECK_HEAP_STATS 0
+#endif
+
+/* Reverses the bytes of a value from a dump written with the other byte
+order. */
+#define replaySWAP16( x )	( ( uint16_t ) ( ( ( x ) >> 8 ) | ( ( x ) << 8 ) ) )
+#define replaySWAP32( x )	( ( ( ( x ) & 0xffUL ) << 24 ) | ( ( ( x ) & 0xff00UL ) << 8 ) | ( ( ( x ) >> 8 ) & 0xff00UL ) | ( ( x ) >> 24 ) )
+
+/* Maps the address of a block on the target to the block allocated for it
+during the replay.  An open addressed hash table, with linear probing. */
+typedef struct xREPLAY_BLOCK
+{
+	uint32_t ulTargetAddress;	/*< 0 if the entry is not in use. */
+	uint32_t ulSize;
+	void *pvBlock;
+} ReplayBlock_t;
+
+/* Results of the replay. */
+typedef struct xREPLAY_RESULTS
+{
+	uint32_t ulMallocs;
+	uint32_t ulFrees;
+	uint32_t ulReplayFailures;
+	uint32_t ulTargetFailures;
+	uint32_t ulUnmatchedFrees;
+	uint32_t ulLostRecords;
+	size_t xLiveBytes;
+	size_t xPeakLiveBytes;
+	size_t xMinimumFreeBytes;
+	uint64_t ullTotalMallocTime;
+	uint64_t ullTotalFreeTime;
+	uint64_t ullWorstMallocTime;
+	uint64_t ullWorstFreeTime;
+} ReplayResults_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Read every dump in the file pcFileName and replay its records.  Returns
+ * pdFAIL if the file could not be read.
+ */
+static BaseType_t prvReplayFile( const char *pcFileName );
+
+/*
+ * Replay a single record.
+ */
+static void prvReplayRecord( const HeapTraceRecord_t *pxRecord );
+
+/*
+ * Find the entry for ulTargetAddress in the block table, or the free entry
+ * where it would be added.
+ */
+static ReplayBlock_t *prvFindBlock( uint32_t ulTargetAddress );
+
+/*
+ * Add an entry to, or remove an entry from, the block table.
+ */
+static void prvAddBlock( uint32_t ulTargetAddress, uint32_t ulSize, void *pvBlock );
+static void prvRemoveBlock( ReplayBlock_t *pxEntry );
+
+/*
+ * Return the size of the largest block that can be allocated.
+ */
+static size_t prvLargestAllocatableBlock( void );
+
+/*
+ * Return the number of free blocks found by walking the free list.  Defined
+ * after the heap implementation is included, as it uses the list.
+ */
+#if( REPLAY_CHECK_HEAP_STATS == 1 )
+	static size_t prvCountFreeBlocks( void );
+#endif
+
+/*
+ * Return a timestamp in nanoseconds.
+ */
+static uint64_t prvNanoseconds( void );
+
+/*-----------------------------------------------------------*/
+
+static ReplayBlock_t *pxBlockTable = NULL;
+static size_t xBlockTableSize = 0, xBlocksInTable = 0;
+
+static ReplayResults_t xResults;
+
+/* The number the next record is expected to have. */
+static uint32_t ulNextRecordNumber = 0;
+
+#if( REPLAY_USE_HEAP_REGIONS == 1 )
+	static uint8_t ucReplayHeap[ configTOTAL_HEAP_SIZE + ( ( REPLAY_HEAP_REGIONS - 1 ) * replayREGION_GAP ) ];
+#endif
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+int iArgument;
+size_t xFreeBytes, xLargest;
+#if( REPLAY_CHECK_HEAP_STATS == 1 )
+	HeapStats_t xHeapStats;
+	size_t xCountedFreeBlocks;
+#endif
+
+	if( argc < 2 )
+	{
+		fprintf( stderr, "Usage: %s trace_file [trace_file ...]\n", argv[ 0 ] );
+		return EXIT_FAILURE;
+	}
+
+	#if( REPLAY_USE_HEAP_REGIONS == 1 )
+	{
+	HeapRegion_t xRegions[ REPLAY_HEAP_REGIONS + 1 ];
+
+		/* Clear the regions so any member this file does not know about is
+		zero. */
+		memset( xRegions, 0x00, sizeof( xRegions ) );
+		xRegions[ 0 ].pucStartAddress = ucReplayHeap;
+		xRegions[ 0 ].xSizeInBytes = configTOTAL_HEAP_SIZE / REPLAY_HEAP_REGIONS;
+
+		#if( REPLAY_HEAP_REGIONS == 2 )
+		{
+			/* The gap stops the two regions being contiguous, so the end
+			marker of the first stays in the free list. */
+			xRegions[ 1 ].pucStartAddress = ucReplayHeap + xRegions[ 0 ].xSizeInBytes + replayREGION_GAP;
+			xRegions[ 1 ].xSizeInBytes = configTOTAL_HEAP_SIZE - xRegions[ 0 ].xSizeInBytes;
+		}
+		#endif
+
+		vPortDefineHeapRegions( xRegions );
+	}
+	#endif
+
+	memset( &xResults, 0x00, sizeof( xResults ) );
+	xResults.xMinimumFreeBytes = configTOTAL_HEAP_SIZE;
+
+	for( iArgument = 1; iArgument < argc; iArgument++ )
+	{
+		if( prvReplayFile( argv[ iArgument ] ) == pdFAIL )
+		{
+			return EXIT_FAILURE;
+		}
+	}
+
+	#if( REPLAY_CHECK_HEAP_STATS == 1 )
+	{
+		/* Checked before the largest block is probed for, so a failure is
+		caused by the replay itself. */
+		vPortGetHeapStats( &xHeapStats );
+		xCountedFreeBlocks = prvCountFreeBlocks();
+
+		if( xHeapStats.xNumberOfFreeBlocks != xCountedFreeBlocks )
+		{
+			fprintf( stderr, "vPortGetHeapStats() reported %lu free blocks, but the free list holds %lu\n", ( unsigned long ) xHeapStats.xNumberOfFreeBlocks, ( unsigned long ) xCountedFreeBlocks );
+			return EXIT_FAILURE;
+		}
+	}
+	#endif
+
+	xFreeBytes = xPortGetFreeHeapSize();
+	xLargest = prvLargestAllocatableBlock();
+
+	printf( "Heap:                       heap_%d.c, %lu bytes in %d region(s)\n", REPLAY_HEAP, ( unsigned long ) configTOTAL_HEAP_SIZE, REPLAY_USE_HEAP_REGIONS ? REPLAY_HEAP_REGIONS : 1 );
+	printf( "Allocations:                %lu (%lu failed, %lu failed on the target)\n", ( unsigned long ) xResults.ulMallocs, ( unsigned long ) xResults.ulReplayFailures, ( unsigned long ) xResults.ulTargetFailures );
+	printf( "Frees:                      %lu (%lu of unknown blocks skipped)\n", ( unsigned long ) xResults.ulFrees, ( unsigned long ) xResults.ulUnmatchedFrees );
+	printf( "Records lost:               %lu\n", ( unsigned long ) xResults.ulLostRecords );
+	printf( "Peak bytes allocated:       %lu\n", ( unsigned long ) xResults.xPeakLiveBytes );
+	printf( "Peak heap bytes used:       %lu\n", ( unsigned long ) ( configTOTAL_HEAP_SIZE - xResults.xMinimumFreeBytes ) );
+	printf( "Fragmentation at end:       %lu%% (%lu free, largest block %lu)\n", ( xFreeBytes == 0 ) ? 0UL : ( unsigned long ) ( ( ( xFreeBytes - xLargest ) * 100 ) / xFreeBytes ), ( unsigned long ) xFreeBytes, ( unsigned long ) xLargest );
+	printf( "pvPortMalloc() mean/worst:  %lu/%lu ns\n", ( xResults.ulMallocs == 0 ) ? 0UL : ( unsigned long ) ( xResults.ullTotalMallocTime / xResults.ulMallocs ), ( unsigned long ) xResults.ullWorstMallocTime );
+	printf( "vPortFree() mean/worst:     %lu/%lu ns\n", ( xResults.ulFrees == 0 ) ? 0UL : ( unsigned long ) ( xResults.ullTotalFreeTime / xResults.ulFrees ), ( unsigned long ) xResults.ullWorstFreeTime );
+
+	return EXIT_SUCCESS;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReplayFile( const char *pcFileName )
+{
+FILE *pxFile;
+HeapTraceDumpHeader_t xHeader;
+HeapTraceRecord_t xRecord;
+BaseType_t xSwap, xReturn = pdPASS;
+uint32_t ulRecord;
+
+	pxFile = fopen( pcFileName, "rb" );
+
+	if( pxFile == NULL )
+	{
+		fprintf( stderr, "Cannot open %s\n", pcFileName );
+		return pdFAIL;
+	}
+
+	while( fread( &xHeader, sizeof( xHeader ), 1, pxFile ) == 1 )
+	{
+		if( xHeader.ulMagic == htDUMP_MAGIC )
+		{
+			xSwap = pdFALSE;
+		}
+		else if( xHeader.ulMagic == replaySWAP32( htDUMP_MAGIC ) )
+		{
+			xSwap = pdTRUE;
+			xHeader.usVersion = replaySWAP16( xHeader.usVersion );
+			xHeader.usRecordSize = replaySWAP16( xHeader.usRecordSize );
+			xHeader.ulFirstRecordNumber = replaySWAP32( xHeader.ulFirstRecordNumber );
+			xHeader.ulRecordCount = replaySWAP32( xHeader.ulRecordCount );
+		}
+		else
+		{
+			fprintf( stderr, "%s is not a heap trace, or is corrupt\n", pcFileName );
+			xReturn = pdFAIL;
+			break;
+		}
+
+		if( ( xHeader.usVersion != htDUMP_VERSION ) || ( xHeader.usRecordSize != sizeof( HeapTraceRecord_t ) ) )
+		{
+			fprintf( stderr, "%s was written by an unsupported version of HeapTrace.c\n", pcFileName );
+			xReturn = pdFAIL;
+			break;
+		}
+
+		/* Records numbered between the end of the last dump and the start of
+		this one were lost. */
+		xResults.ulLostRecords += xHeader.ulFirstRecordNumber - ulNextRecordNumber;
+		ulNextRecordNumber = xHeader.ulFirstRecordNumber + xHeader.ulRecordCount;
+
+		for( ulRecord = 0; ulRecord < xHeader.ulRecordCount; ulRecord++ )
+		{
+			if( fread( &xRecord, sizeof( xRecord ), 1, pxFile ) != 1 )
+			{
+				fprintf( stderr, "%s is truncated\n", pcFileName );
+				xReturn = pdFAIL;
+				break;
+			}
+
+			if( xSwap != pdFALSE )
+			{
+				xRecord.ulTimestamp = replaySWAP32( xRecord.ulTimestamp );
+				xRecord.ulAddress = replaySWAP32( xRecord.ulAddress );
+				xRecord.ulSizeAndTask = replaySWAP32( xRecord.ulSizeAndTask );
+			}
+
+			prvReplayRecord( &xRecord );
+		}
+
+		if( xReturn == pdFAIL )
+		{
+			break;
+		}
+	}
+
+	fclose( pxFile );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReplayRecord( const HeapTraceRecord_t *pxRecord )
+{
+uint32_t ulSize = pxRecord->ulSizeAndTask & htRECORD_SIZE_MASK;
+ReplayBlock_t *pxEntry;
+void *pvBlock;
+uint64_t ullStart, ullElapsed;
+size_t xFreeBytes;
+
+	if( ( pxRecord->ulSizeAndTask & htRECORD_FREE_BIT ) == 0UL )
+	{
+		if( pxRecord->ulAddress == 0UL )
+		{
+			xResults.ulTargetFailures++;
+			return;
+		}
+
+		pxEntry = prvFindBlock( pxRecord->ulAddress );
+
+		if( pxEntry->ulTargetAddress != 0UL )
+		{
+			/* The free of the block previously at this address was lost. */
+			vPortFree( pxEntry->pvBlock );
+			xResults.xLiveBytes -= pxEntry->ulSize;
+			prvRemoveBlock( pxEntry );
+		}
+
+		ullStart = prvNanoseconds();
+		pvBlock = pvPortMalloc( ( size_t ) ulSize );
+		ullElapsed = prvNanoseconds() - ullStart;
+
+		xResults.ulMallocs++;
+		xResults.ullTotalMallocTime += ullElapsed;
+
+		if( ullElapsed > xResults.ullWorstMallocTime )
+		{
+			xResults.ullWorstMallocTime = ullElapsed;
+		}
+
+		if( pvBlock == NULL )
+		{
+			/* The application's free of this block is skipped. */
+			xResults.ulReplayFailures++;
+		}
+		else
+		{
+			prvAddBlock( pxRecord->ulAddress, ulSize, pvBlock );
+			xResults.xLiveBytes += ulSize;
+
+			if( xResults.xLiveBytes > xResults.xPeakLiveBytes )
+			{
+				xResults.xPeakLiveBytes = xResults.xLiveBytes;
+			}
+
+			/* Not every implementation provides
+			xPortGetMinimumEverFreeHeapSize(). */
+			xFreeBytes = xPortGetFreeHeapSize();
+
+			if( xFreeBytes < xResults.xMinimumFreeBytes )
+			{
+				xResults.xMinimumFreeBytes = xFreeBytes;
+			}
+		}
+	}
+	else
+	{
+		pxEntry = prvFindBlock( pxRecord->ulAddress );
+
+		if( pxEntry->ulTargetAddress == 0UL )
+		{
+			xResults.ulUnmatchedFrees++;
+			return;
+		}
+
+		ullStart = prvNanoseconds();
+		vPortFree( pxEntry->pvBlock );
+		ullElapsed = prvNanoseconds() - ullStart;
+
+		xResults.ulFrees++;
+		xResults.ullTotalFreeTime += ullElapsed;
+
+		if( ullElapsed > xResults.ullWorstFreeTime )
+		{
+			xResults.ullWorstFreeTime = ullElapsed;
+		}
+
+		xResults.xLiveBytes -= pxEntry->ulSize;
+		prvRemoveBlock( pxEntry );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static ReplayBlock_t *prvFindBlock( uint32_t ulTargetAddress )
+{
+size_t xIndex;
+
+	if( xBlockTableSize == 0 )
+	{
+		/* Create the table the first time it is used.  Its size is always a
+		power of two. */
+		xBlockTableSize = 1024;
+		pxBlockTable = calloc( xBlockTableSize, sizeof( ReplayBlock_t ) );
+
+		if( pxBlockTable == NULL )
+		{
+			fprintf( stderr, "Out of memory\n" );
+			exit( EXIT_FAILURE );
+		}
+	}
+
+	/* Blocks are aligned, so the low bits of the address carry little
+	information. */
+	xIndex = ( size_t ) ( ( ulTargetAddress >> 3 ) * 2654435761UL ) & ( xBlockTableSize - 1 );
+
+	while( ( pxBlockTable[ xIndex ].ulTargetAddress != 0UL ) && ( pxBlockTable[ xIndex ].ulTargetAddress != ulTargetAddress ) )
+	{
+		xIndex = ( xIndex + 1 ) & ( xBlockTableSize - 1 );
+	}
+
+	return &( pxBlockTable[ xIndex ] );
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddBlock( uint32_t ulTargetAddress, uint32_t ulSize, void *pvBlock )
+{
+ReplayBlock_t *pxOldTable, *pxEntry;
+size_t xOldSize, x;
+
+	/* Keep the table no more than half full, so searches stay short. */
+	if( ( xBlocksInTable + 1 ) * 2 > xBlockTableSize )
+	{
+		pxOldTable = pxBlockTable;
+		xOldSize = xBlockTableSize;
+		xBlockTableSize *= 2;
+		pxBlockTable = calloc( xBlockTableSize, sizeof( ReplayBlock_t ) );
+
+		if( pxBlockTable == NULL )
+		{
+			fprintf( stderr, "Out of memory\n" );
+			exit( EXIT_FAILURE );
+		}
+
+		for( x = 0; x < xOldSize; x++ )
+		{
+			if( pxOldTable[ x ].ulTargetAddress != 0UL )
+			{
+				*prvFindBlock( pxOldTable[ x ].ulTargetAddress ) = pxOldTable[ x ];
+			}
+		}
+
+		free( pxOldTable );
+	}
+
+	pxEntry = prvFindBlock( ulTargetAddress );
+	pxEntry->ulTargetAddress = ulTargetAddress;
+	pxEntry->ulSize = ulSize;
+	pxEntry->pvBlock = pvBlock;
+	xBlocksInTable++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlock( ReplayBlock_t *pxEntry )
+{
+size_t xHole, xIndex, xHome;
+
+	/* Move later entries of the same probe sequence back into the hole, so
+	searches never stop early at an entry that has been removed. */
+	xHole = ( size_t ) ( pxEntry - pxBlockTable );
+	xIndex = xHole;
+
+	for( ;; )
+	{
+		xIndex = ( xIndex + 1 ) & ( xBlockTableSize - 1 );
+
+		if( pxBlockTable[ xIndex ].ulTargetAddress == 0UL )
+		{
+			break;
+		}
+
+		xHome = ( size_t ) ( ( pxBlockTable[ xIndex ].ulTargetAddress >> 3 ) * 2654435761UL ) & ( xBlockTableSize - 1 );
+
+		/* The entry can fill the hole if its home position is not between
+		the hole and the entry, allowing for wrap around. */
+		if( ( ( xIndex - xHome ) & ( xBlockTableSize - 1 ) ) >= ( ( xIndex - xHole ) & ( xBlockTableSize - 1 ) ) )
+		{
+			pxBlockTable[ xHole ] = pxBlockTable[ xIndex ];
+			xHole = xIndex;
+		}
+	}
+
+	pxBlockTable[ xHole ].ulTargetAddress = 0UL;
+	xBlocksInTable--;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvLargestAllocatableBlock( void )
+{
+size_t xLargest = 0, xTry;
+void *pvBlock;
+
+	/* Probe down from the free heap size.  Every implementation rounds
+	requests up to the byte alignment, so probing in steps of the alignment
+	finds the exact size.  A failed probe leaves the heap unchanged, and the
+	only probe that succeeds is for the largest block, so heap_2.c, which never
+	combines free blocks, is not fragmented further by probes that split a
+	larger block. */
+	xTry = xPortGetFreeHeapSize() & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	while( ( xTry > 0 ) && ( xLargest == 0 ) )
+	{
+		pvBlock = pvPortMalloc( xTry );
+
+		if( pvBlock != NULL )
+		{
+			vPortFree( pvBlock );
+			xLargest = xTry;
+		}
+		else
+		{
+			xTry -= portBYTE_ALIGNMENT;
+		}
+	}
+
+	return xLargest;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNanoseconds( void )
+{
+struct timespec xTime;
+
+	clock_gettime( CLOCK_MONOTONIC, &xTime );
+	return ( ( uint64_t ) xTime.tv_sec * 1000000000ULL ) + ( uint64_t ) xTime.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/* There is no scheduler, so there is nothing to suspend. */
+void vTaskSuspendAll( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskResumeAll( void )
+{
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/* The heap implementation being measured. */
+#if( REPLAY_HEAP == 2 )
+	#include "../../../../Source/portable/MemMang/heap_2.c"
+#elif( REPLAY_HEAP == 4 )
+	#include "../../../../Source/portable/MemMang/heap_4.c"
+#elif( REPLAY_HEAP == 5 )
+	#include "../../../../Source/portable/MemMang/heap_5.c"
+#elif( REPLAY_HEAP == 6 )
+	#include "../../../../Source/portable/MemMang/heap_6.c"
+#elif( REPLAY_HEAP == 7 )
+	#include "../../../../Source/portable/MemMang/heap_7.c"
+#endif
+/*-----------------------------------------------------------*/
+
+#if( REPLAY_CHECK_HEAP_STATS == 1 )
+
+	static size_t prvCountFreeBlocks( void )
+	{
+	BlockLink_t *pxBlock;
+	size_t xCount = 0;
+
+		/* The end markers of all but the last heap_5.c region are in the list
+		too, but have a size of zero so are not counted. */
+		for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+		{
+			if( pxBlock->xBlockSize != ( size_t ) 0 )
+			{
+				xCount++;
+			}
+		}
+
+		return xCount;
+	}
+
+#endif /* REPLAY_CHECK_HEAP_STATS */
@@ -0,0 +1,139 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef HEAP_TRACE_H
+#define HEAP_TRACE_H
+
+/*
+ * Records every pvPortMalloc() and vPortFree() call in a RAM ring buffer so
+ * the allocations made by a real application can be dumped, for example over
+ * a UART, and replayed through each heap implementation on a host computer by
+ * Utils/HeapReplay/HeapReplay.c.  See HeapTrace.c.
+ *
+ * To record calls add the following to FreeRTOSConfig.h, inside a block that
+ * is excluded when FreeRTOSConfig.h is included from assembly files:
+ *
+ *	void vHeapTraceRecordMalloc( void *pvAddress, size_t xSize );
+ *	void vHeapTraceRecordFree( void *pvAddress, size_t xSize );
+ *	#define traceMALLOC_REQUESTED( pvAddress, uiRequestedSize )	vHeapTraceRecordMalloc( pvAddress, uiRequestedSize )
+ *	#define traceFREE( pvAddress, uiSize )							vHeapTraceRecordFree( pvAddress, uiSize )
+ *
+ * traceMALLOC_REQUESTED() is used rather than traceMALLOC() as it is passed the
+ * size the application asked for, whereas the size some heap implementations
+ * pass to traceMALLOC() includes their own header and alignment padding.
+ */
+
+/* The first word of a dump.  A dump is written in the byte order of the
+target, so a host with the other byte order reads the value byte reversed. */
+#define htDUMP_MAGIC				( 0x43525448UL )
+#define htDUMP_VERSION				( ( uint16_t ) 2 )
+
+/* Fields packed into the ulSizeAndTask member of a record.  The task number is
+the number set by vTaskSetTaskNumber(), and is only recorded when
+configUSE_TRACE_FACILITY and INCLUDE_xTaskGetCurrentTaskHandle are both 1. */
+#define htRECORD_FREE_BIT			( 0x80000000UL )
+#define htRECORD_TASK_SHIFT			( 24 )
+#define htRECORD_TASK_MASK			( 0x7fUL )
+#define htRECORD_SIZE_MASK			( 0x00ffffffUL )
+
+/* One call to pvPortMalloc() or vPortFree().  An ulAddress of 0 in a
+pvPortMalloc() record means the allocation failed.  The size in a pvPortMalloc()
+record is the size the application passed to pvPortMalloc().  The size in a
+vPortFree() record is the size passed to traceFREE() by the heap
+implementation, which may include its own header and alignment padding, and is
+not used by the replay. */
+typedef struct xHEAP_TRACE_RECORD
+{
+	uint32_t ulTimestamp;
+	uint32_t ulAddress;
+	uint32_t ulSizeAndTask;
+} HeapTraceRecord_t;
+
+/* Written at the start of each dump, and followed by ulRecordCount records.
+Records are numbered from 0 in the order the calls were made, so a gap between
+the numbers of consecutive dumps shows records were lost - either overwritten
+because the buffer was full, or made while a dump was in progress. */
+typedef struct xHEAP_TRACE_DUMP_HEADER
+{
+	uint32_t ulMagic;
+	uint16_t usVersion;
+	uint16_t usRecordSize;
+	uint32_t ulFirstRecordNumber;
+	uint32_t ulRecordCount;
+} HeapTraceDumpHeader_t;
+
+/* Called by vHeapTraceDump() to write each part of the dump. */
+typedef void ( *HeapTraceWriteFunction_t )( const void *pvData, size_t xLength );
+
+void vHeapTraceRecordMalloc( void *pvAddress, size_t xSize );
+void vHeapTraceRecordFree( void *pvAddress, size_t xSize );
+void vHeapTraceDump( HeapTraceWriteFunction_t pxWriteFunction );
+
+#endif /* HEAP_TRACE_H */
+
@@ -16,14 +16,18 @@
  * SH		29 Sept. 2021	v2.3	Disable blocking delay_us()
  *									Replaced by a blocking delay that does not use the core timer.	
  *									See util.c
- *
- *	Warning: Cannot use a blocking delay method along with a clock polling method
- *				because the blocking delay resets the core clock.
+ * 		18 Oct. 2026	v2.4	Never write the core timer count.  It is free running
+ *									and shared with the FreeRTOS high resolution timers
+ *									(see hrtimer.h), so all timing uses count differences.
+ *									TickCoreReset() now only moves the origin of TickGet().
  **/
 #include <xc.h>
 #include <stdint.h>
 #include "Tick_core.h"
 
+/* Core timer count at the last call to TickCoreReset() */
+static uint32_t tick_origin = 0;
+
 
 /* Blocking delay function using tick_core */
 // void delay_us(unsigned int us)
@@ -43,21 +47,20 @@
 void delay_ticks(unsigned int tics)
 {
     // Convert microseconds us into how many clock ticks it will take
+    uint32_t start = _CP0_GET_COUNT();
     tics = tics/2; // Core Timer updates every 2 ticks
 
-    _CP0_SET_COUNT(0); // Set Core Timer count to 0
-
-    while (tics > _CP0_GET_COUNT()); // Wait until Core Timer count reaches the number we calculated earlier
+    while (tics > (uint32_t)(_CP0_GET_COUNT() - start)); // Wait until the unsigned difference, which is correct across a rollover, reaches the number we calculated earlier
 }
 
 /* Gets the core clock timer current tick value */
 int64_t TickGet(void){
-    return _CP0_GET_COUNT()*2;
+    return (uint32_t)(_CP0_GET_COUNT() - tick_origin)*2;
 }
 
-/* Reset the core clock timer to 0 */
+/* Make TickGet() count from 0 again. The core timer itself is not written */
 void TickCoreReset(void){
-        _CP0_SET_COUNT(0); // Set Core Timer count to 0
+        tick_origin = _CP0_GET_COUNT();
 }
 
 /* Returns the difference between the current core timer ticks and the latest stamp value   */